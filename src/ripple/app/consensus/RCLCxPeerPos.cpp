@@ -1,5 +1,6 @@
 
 #include <ripple/app/consensus/RCLCxPeerPos.h>
+#include <ripple/app/misc/SignatureVerifier.h>
 #include <ripple/core/Config.h>
 #include <ripple/protocol/HashPrefix.h>
 #include <ripple/protocol/jss.h>
@@ -29,10 +30,13 @@ RCLCxPeerPos::signingHash() const
         proposal().position());
 }
 bool
-RCLCxPeerPos::checkSign() const
+RCLCxPeerPos::checkSign(
+    SignatureVerifier& verifier,
+    bool trusted,
+    std::function<void(bool)> callback) const
 {
-    return verifyDigest(
-        publicKey(), signingHash(), signature(), false);
+    return verifier.verifyDigest(publicKey(), signingHash(), signature(),
+        false, trusted, std::move(callback));
 }
 Json::Value
 RCLCxPeerPos::getJson() const
@@ -10,8 +10,10 @@
 #include <ripple/protocol/SecretKey.h>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <string>
 namespace ripple {
+class SignatureVerifier;
 class RCLCxPeerPos
 {
 public:
@@ -24,7 +26,10 @@ public:
     uint256
     signingHash() const;
     bool
-    checkSign() const;
+    checkSign(
+        SignatureVerifier& verifier,
+        bool trusted,
+        std::function<void(bool)> callback) const;
     Slice
     signature() const
     {
@@ -25,7 +25,6 @@ AcceptedLedgerTx::AcceptedLedgerTx (
     Serializer s;
     met->add(s);
     mRawMeta = std::move (s.modData());
-    buildJson ();
 }
 AcceptedLedgerTx::AcceptedLedgerTx (
     std::shared_ptr<ReadView const> const& ledger,
@@ -41,26 +40,25 @@ AcceptedLedgerTx::AcceptedLedgerTx (
     , logs_ (logs)
 {
     assert (ledger->open());
-    buildJson ();
 }
 std::string AcceptedLedgerTx::getEscMeta () const
 {
     assert (!mRawMeta.empty ());
     return sqlEscape (mRawMeta);
 }
-void AcceptedLedgerTx::buildJson ()
+Json::Value AcceptedLedgerTx::getJson () const
 {
-    mJson = Json::objectValue;
-    mJson[jss::transaction] = mTxn->getJson (JsonOptions::none);
+    Json::Value ret (Json::objectValue);
+    ret[jss::transaction] = mTxn->getJson (JsonOptions::none);
     if (mMeta)
     {
-        mJson[jss::meta] = mMeta->getJson (JsonOptions::none);
-        mJson[jss::raw_meta] = strHex (mRawMeta);
+        ret[jss::meta] = mMeta->getJson (JsonOptions::none);
+        ret[jss::raw_meta] = strHex (mRawMeta);
     }
-    mJson[jss::result] = transHuman (mResult);
+    ret[jss::result] = transHuman (mResult);
     if (! mAffected.empty ())
     {
-        Json::Value& affected = (mJson[jss::affected] = Json::arrayValue);
+        Json::Value& affected = (ret[jss::affected] = Json::arrayValue);
         for (auto const& account: mAffected)
             affected.append (accountCache_.toBase58(account));
     }
@@ -72,8 +70,9 @@ void AcceptedLedgerTx::buildJson ()
         {
             auto const ownerFunds = accountFunds(*mLedger,
                 account, amount, fhIGNORE_FREEZE, logs_.journal ("View"));
-            mJson[jss::transaction][jss::owner_funds] = ownerFunds.getText ();
+            ret[jss::transaction][jss::owner_funds] = ownerFunds.getText ();
         }
     }
+    return ret;
 }
 } 
@@ -61,10 +61,11 @@ public:
         return mMeta ? mMeta->getIndex () : 0;
     }
     std::string getEscMeta () const;
-    Json::Value getJson () const
+    Blob const& getRawMeta () const
     {
-        return mJson;
+        return mRawMeta;
     }
+    Json::Value getJson () const;
 private:
     std::shared_ptr<ReadView const> mLedger;
     std::shared_ptr<STTx const> mTxn;
@@ -72,10 +73,8 @@ private:
     TER                             mResult;
     boost::container::flat_set<AccountID> mAffected;
     Blob        mRawMeta;
-    Json::Value                     mJson;
     AccountIDCache const& accountCache_;
     Logs& logs_;
-    void buildJson ();
 };
 } 
 #endif
@@ -17,7 +17,7 @@ BookListeners::removeSubscriber(std::uint64_t seq)
 }
 void
 BookListeners::publish(
-    Json::Value const& jvObj,
+    InfoSub::Message const& msg,
     hash_set<std::uint64_t>& havePublished)
 {
     std::lock_guard<std::recursive_mutex> sl(mLock);
@@ -29,7 +29,7 @@ BookListeners::publish(
         {
             if(havePublished.emplace(p->getSeq()).second)
             {
-                p->send(jvObj, true);
+                p->send(msg, true);
             }
             ++it;
         }
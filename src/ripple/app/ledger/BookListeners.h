@@ -16,7 +16,7 @@ public:
     void
     removeSubscriber(std::uint64_t sub);
     void
-    publish(Json::Value const& jvObj, hash_set<std::uint64_t>& havePublished);
+    publish(InfoSub::Message const& msg, hash_set<std::uint64_t>& havePublished);
 private:
     std::recursive_mutex mLock;
     hash_map<std::uint64_t, InfoSub::wptr> mListeners;
@@ -23,6 +23,7 @@ public:
         HISTORY,  
         SHARD,    
         GENERIC,  
+        CLIENT,   
         CONSENSUS 
     };
     InboundLedger(Application& app, uint256 const& hash,
@@ -89,11 +90,13 @@ private:
                      SHAMapAddNode&);
     bool takeAsRootNode (Slice const& data, SHAMapAddNode&);
     std::vector<uint256>
-    neededTxHashes (
-        int max, SHAMapSyncFilter* filter) const;
+    neededTxHashes (int max, SHAMapSyncFilter* filter,
+        NodeStore::ReadPriority priority) const;
     std::vector<uint256>
-    neededStateHashes (
-        int max, SHAMapSyncFilter* filter) const;
+    neededStateHashes (int max, SHAMapSyncFilter* filter,
+        NodeStore::ReadPriority priority) const;
+    NodeStore::ReadPriority
+    readPriority () const;
     std::shared_ptr<Ledger> mLedger;
     bool mHaveHeader;
     bool mHaveState;
@@ -25,6 +25,7 @@
 #include <ripple/protocol/Indexes.h>
 #include <ripple/protocol/jss.h>
 #include <ripple/protocol/PublicKey.h>
+#include <ripple/protocol/TxFormats.h>
 #include <ripple/protocol/SecretKey.h>
 #include <ripple/protocol/HashPrefix.h>
 #include <ripple/protocol/UintTypes.h>
@@ -647,10 +648,13 @@ void Ledger::updateSkipList ()
     else
         rawReplace(sle);
 }
-static bool saveValidatedLedger (
+static std::size_t constexpr saveBatchSize = 32;
+static std::size_t constexpr maxQueuedSaves = 256;
+static bool prepareSave (
     Application& app,
     std::shared_ptr<Ledger const> const& ledger,
-    bool current)
+    bool current,
+    AcceptedLedger::pointer& aLedger)
 {
     auto j = app.journal ("Ledger");
     auto seq = ledger->info().seq;
@@ -662,14 +666,6 @@ static bool saveValidatedLedger (
     JLOG (j.trace())
         << "saveValidatedLedger "
         << (current ? "" : "fromAcquire ") << seq;
-    static boost::format deleteLedger (
-        "DELETE FROM Ledgers WHERE LedgerSeq = %u;");
-    static boost::format deleteTrans1 (
-        "DELETE FROM Transactions WHERE LedgerSeq = %u;");
-    static boost::format deleteTrans2 (
-        "DELETE FROM AccountTransactions WHERE LedgerSeq = %u;");
-    static boost::format deleteAcctTrans (
-        "DELETE FROM AccountTransactions WHERE TransID = '%s';");
     if (! ledger->info().accountHash.isNonZero ())
     {
         JLOG (j.fatal()) << "AH is zero: "
@@ -692,7 +688,6 @@ static bool saveValidatedLedger (
         app.getNodeStore().store(hotLEDGER,
             std::move(s.modData()), ledger->info().hash, seq);
     }
-    AcceptedLedger::pointer aLedger;
     try
     {
         aLedger = app.getAcceptedLedgerCache().fetch (ledger->info().hash);
@@ -709,95 +704,129 @@ static bool saveValidatedLedger (
         app.pendingSaves().finishWork(seq);
         return false;
     }
-    {
-        auto db = app.getLedgerDB ().checkoutDb();
-        *db << boost::str (deleteLedger % seq);
-    }
+    return true;
+}
+using SaveBatch = std::vector<std::pair<std::shared_ptr<Ledger const>,
+    std::shared_ptr<AcceptedLedger>>>;
+static void insertLedgers (
+    Application& app,
+    SaveBatch const& ledgers)
+{
+    auto j = app.journal ("Ledger");
     {
         auto db = app.getTxnDB ().checkoutDb ();
         soci::transaction tr(*db);
-        *db << boost::str (deleteTrans1 % seq);
-        *db << boost::str (deleteTrans2 % seq);
-        std::string const ledgerSeq (std::to_string (seq));
-        for (auto const& vt : aLedger->getMap ())
+        std::uint32_t ledgerSeq;
+        std::uint32_t txnSeq;
+        std::uint32_t fromSeq;
+        std::string txnId;
+        std::string txnType;
+        std::string account;
+        std::string const status (1, txnSqlValidated);
+        soci::blob rawTxn (*db);
+        soci::blob txnMeta (*db);
+        soci::statement deleteTrans1 = (db->prepare <<
+            "DELETE FROM Transactions WHERE LedgerSeq = :seq;",
+            soci::use (ledgerSeq));
+        soci::statement deleteTrans2 = (db->prepare <<
+            "DELETE FROM AccountTransactions WHERE LedgerSeq = :seq;",
+            soci::use (ledgerSeq));
+        soci::statement deleteAcctTrans = (db->prepare <<
+            "DELETE FROM AccountTransactions WHERE TransID = :txnId;",
+            soci::use (txnId));
+        soci::statement insertAcctTrans = (db->prepare <<
+            "INSERT INTO AccountTransactions "
+            "(TransID, Account, LedgerSeq, TxnSeq) VALUES "
+            "(:txnId, :account, :ledgerSeq, :txnSeq);",
+            soci::use (txnId),
+            soci::use (account),
+            soci::use (ledgerSeq),
+            soci::use (txnSeq));
+        soci::statement insertTrans = (db->prepare <<
+            "INSERT OR REPLACE INTO Transactions "
+            "(TransID, TransType, FromAcct, FromSeq, LedgerSeq, Status, "
+            "RawTxn, TxnMeta) VALUES "
+            "(:txnId, :txnType, :account, :fromSeq, :ledgerSeq, :status, "
+            ":rawTxn, COALESCE(:txnMeta, X''));",
+            soci::use (txnId),
+            soci::use (txnType),
+            soci::use (account),
+            soci::use (fromSeq),
+            soci::use (ledgerSeq),
+            soci::use (status),
+            soci::use (rawTxn),
+            soci::use (txnMeta));
+        for (auto const& ledger : ledgers)
         {
-            uint256 transactionID = vt.second->getTransactionID ();
-            app.getMasterTransaction ().inLedger (
-                transactionID, seq);
-            std::string const txnId (to_string (transactionID));
-            std::string const txnSeq (std::to_string (vt.second->getTxnSeq ()));
-            *db << boost::str (deleteAcctTrans % transactionID);
-            auto const& accts = vt.second->getAffected ();
-            if (!accts.empty ())
+            ledgerSeq = ledger.first->info().seq;
+            deleteTrans1.execute (true);
+            deleteTrans2.execute (true);
+            for (auto const& vt : ledger.second->getMap ())
             {
-                std::string sql (
-                    "INSERT INTO AccountTransactions "
-                    "(TransID, Account, LedgerSeq, TxnSeq) VALUES ");
-                sql.reserve (sql.length () + (accts.size () * 128));
-                bool first = true;
-                for (auto const& account : accts)
+                auto const& txn = vt.second->getTxn ();
+                uint256 transactionID = vt.second->getTransactionID ();
+                app.getMasterTransaction ().inLedger (
+                    transactionID, ledgerSeq);
+                txnId = to_string (transactionID);
+                txnSeq = vt.second->getTxnSeq ();
+                deleteAcctTrans.execute (true);
+                auto const& accts = vt.second->getAffected ();
+                if (!accts.empty ())
                 {
-                    if (!first)
-                        sql += ", ('";
-                    else
+                    for (auto const& affected : accts)
                     {
-                        sql += "('";
-                        first = false;
+                        account = app.accountIDCache().toBase58(affected);
+                        insertAcctTrans.execute (true);
                     }
-                    sql += txnId;
-                    sql += "','";
-                    sql += app.accountIDCache().toBase58(account);
-                    sql += "',";
-                    sql += ledgerSeq;
-                    sql += ",";
-                    sql += txnSeq;
-                    sql += ")";
                 }
-                sql += ";";
-                JLOG (j.trace()) << "ActTx: " << sql;
-                *db << sql;
-            }
-            else
-            {
-                JLOG (j.warn())
-                    << "Transaction in ledger " << seq
-                    << " affects no accounts";
-                JLOG (j.warn())
-                    << vt.second->getTxn()->getJson(JsonOptions::none);
+                else
+                {
+                    JLOG (j.warn())
+                        << "Transaction in ledger " << ledgerSeq
+                        << " affects no accounts";
+                    JLOG (j.warn())
+                        << txn->getJson(JsonOptions::none);
+                }
+                auto const format =
+                    TxFormats::getInstance().findByType (txn->getTxnType ());
+                assert (format != nullptr);
+                txnType = format ? format->getName () : "";
+                account = toBase58 (txn->getAccountID (sfAccount));
+                fromSeq = txn->getSequence ();
+                Serializer s;
+                txn->add (s);
+                rawTxn.trim (0);
+                convert (s.peekData (), rawTxn);
+                txnMeta.trim (0);
+                convert (vt.second->getRawMeta (), txnMeta);
+                insertTrans.execute (true);
             }
-            *db <<
-               (STTx::getMetaSQLInsertReplaceHeader () +
-                vt.second->getTxn ()->getMetaSQL (
-                    seq, vt.second->getEscMeta ()) + ";");
         }
         tr.commit ();
     }
     {
-        static std::string addLedger(
+        auto db (app.getLedgerDB ().checkoutDb ());
+        soci::transaction tr(*db);
+        std::string hash;
+        std::uint32_t seq;
+        std::string parentHash;
+        std::string drops;
+        NetClock::rep closeTime;
+        NetClock::rep parentCloseTime;
+        NetClock::rep closeTimeResolution;
+        int closeFlags;
+        std::string accountHash;
+        std::string txHash;
+        soci::statement deleteLedger = (db->prepare <<
+            "DELETE FROM Ledgers WHERE LedgerSeq = :seq;",
+            soci::use (seq));
+        soci::statement addLedger = (db->prepare <<
             R"sql(INSERT OR REPLACE INTO Ledgers
                 (LedgerHash,LedgerSeq,PrevHash,TotalCoins,ClosingTime,PrevClosingTime,
                 CloseTimeRes,CloseFlags,AccountSetHash,TransSetHash)
             VALUES
                 (:ledgerHash,:ledgerSeq,:prevHash,:totalCoins,:closingTime,:prevClosingTime,
-                :closeTimeRes,:closeFlags,:accountSetHash,:transSetHash);)sql");
-        static std::string updateVal(
-            R"sql(UPDATE Validations SET LedgerSeq = :ledgerSeq, InitialSeq = :initialSeq
-                WHERE LedgerHash = :ledgerHash;)sql");
-        auto db (app.getLedgerDB ().checkoutDb ());
-        soci::transaction tr(*db);
-        auto const hash = to_string (ledger->info().hash);
-        auto const parentHash = to_string (ledger->info().parentHash);
-        auto const drops = to_string (ledger->info().drops);
-        auto const closeTime =
-            ledger->info().closeTime.time_since_epoch().count();
-        auto const parentCloseTime =
-            ledger->info().parentCloseTime.time_since_epoch().count();
-        auto const closeTimeResolution =
-            ledger->info().closeTimeResolution.count();
-        auto const closeFlags = ledger->info().closeFlags;
-        auto const accountHash = to_string (ledger->info().accountHash);
-        auto const txHash = to_string (ledger->info().txHash);
-        *db << addLedger,
+                :closeTimeRes,:closeFlags,:accountSetHash,:transSetHash);)sql",
             soci::use(hash),
             soci::use(seq),
             soci::use(parentHash),
@@ -807,17 +836,99 @@ static bool saveValidatedLedger (
             soci::use(closeTimeResolution),
             soci::use(closeFlags),
             soci::use(accountHash),
-            soci::use(txHash);
-        *db << updateVal,
+            soci::use(txHash));
+        soci::statement updateVal = (db->prepare <<
+            R"sql(UPDATE Validations SET LedgerSeq = :ledgerSeq, InitialSeq = :initialSeq
+                WHERE LedgerHash = :ledgerHash;)sql",
             soci::use(seq),
             soci::use(seq),
-            soci::use(hash);
+            soci::use(hash));
+        for (auto const& ledger : ledgers)
+        {
+            auto const& info = ledger.first->info();
+            seq = info.seq;
+            hash = to_string (info.hash);
+            parentHash = to_string (info.parentHash);
+            drops = to_string (info.drops);
+            closeTime = info.closeTime.time_since_epoch().count();
+            parentCloseTime = info.parentCloseTime.time_since_epoch().count();
+            closeTimeResolution = info.closeTimeResolution.count();
+            closeFlags = info.closeFlags;
+            accountHash = to_string (info.accountHash);
+            txHash = to_string (info.txHash);
+            deleteLedger.execute (true);
+            addLedger.execute (true);
+            updateVal.execute (true);
+        }
         tr.commit();
     }
-    app.pendingSaves().finishWork(seq);
-    return true;
 }
-
+bool saveValidatedLedgers (
+    Application& app,
+    std::vector<PendingSaves::Save> const& saves)
+{
+    auto j = app.journal ("Ledger");
+    SaveBatch ledgers;
+    ledgers.reserve (saves.size ());
+    bool result = true;
+    for (auto const& save : saves)
+    {
+        AcceptedLedger::pointer aLedger;
+        if (! prepareSave (app, save.first, save.second, aLedger))
+            result = false;
+        else if (aLedger)
+            ledgers.emplace_back (save.first, std::move (aLedger));
+    }
+    if (ledgers.empty ())
+        return result;
+    try
+    {
+        insertLedgers (app, ledgers);
+    }
+    catch (std::exception const& e)
+    {
+        JLOG (j.error()) << "Failed to save " << ledgers.size ()
+            << " ledgers from " << ledgers.front ().first->info().seq
+            << ": " << e.what ();
+        for (auto const& ledger : ledgers)
+        {
+            app.getLedgerMaster().failedSave(
+                ledger.first->info().seq, ledger.first->info().hash);
+            app.pendingSaves().finishWork(ledger.first->info().seq);
+        }
+        return false;
+    }
+    for (auto const& ledger : ledgers)
+        app.pendingSaves().finishWork(ledger.first->info().seq);
+    return result;
+}
+static bool saveValidatedLedger (
+    Application& app,
+    std::shared_ptr<Ledger const> const& ledger,
+    bool current)
+{
+    return saveValidatedLedgers (app, {{ledger, current}});
+}
+static void writeQueuedSaves (Application& app, bool isCurrent)
+{
+    try
+    {
+        do
+        {
+            for (auto batch = app.pendingSaves().takeBatch (saveBatchSize);
+                ! batch.empty ();
+                batch = app.pendingSaves().takeBatch (saveBatchSize))
+            {
+                saveValidatedLedgers (app, batch);
+            }
+        } while (! app.pendingSaves().stopWriting (isCurrent));
+    }
+    catch (...)
+    {
+        app.pendingSaves().abortWriting (isCurrent);
+        throw;
+    }
+}
 bool pendSaveValidated (
     Application& app,
     std::shared_ptr<Ledger const> const& ledger,
@@ -844,19 +955,31 @@ bool pendSaveValidated (
             << ledger->info().seq;
         return true;
     }
-    JobType const jobType {isCurrent ? jtPUBLEDGER : jtPUBOLDLEDGER};
-    char const* const jobName {
-        isCurrent ? "Ledger::pendSave" : "Ledger::pendOldSave"};
-    if (!isSynchronous &&
-        app.getJobQueue().addJob (jobType, jobName,
-        [&app, ledger, isCurrent] (Job&) {
-            saveValidatedLedger(app, ledger, isCurrent);
-        }))
+    if (isSynchronous)
+        return saveValidatedLedger(app, ledger, isCurrent);
+    if (app.pendingSaves().queued () >= maxQueuedSaves)
     {
-        return true;
+        auto const batch = app.pendingSaves().takeBatch (saveBatchSize);
+        if (! batch.empty ())
+            saveValidatedLedgers (app, batch);
     }
-    return saveValidatedLedger(app, ledger, isCurrent);
+    if (app.pendingSaves().enqueue (ledger, isCurrent))
+    {
+        JobType const jobType {isCurrent ? jtPUBLEDGER : jtPUBOLDLEDGER};
+        char const* const jobName {
+            isCurrent ? "Ledger::pendSave" : "Ledger::pendOldSave"};
+        if (! app.getJobQueue().addJob (jobType, jobName,
+            [&app, isCurrent] (Job&)
+            {
+                writeQueuedSaves (app, isCurrent);
+            }))
+        {
+            writeQueuedSaves (app, isCurrent);
+        }
+    }
+    return true;
 }
+
 void
 Ledger::make_v2()
 {
@@ -1,5 +1,6 @@
 #ifndef RIPPLE_APP_LEDGER_LEDGER_H_INCLUDED
 #define RIPPLE_APP_LEDGER_LEDGER_H_INCLUDED
+#include <ripple/app/ledger/PendingSaves.h>
 #include <ripple/ledger/TxMeta.h>
 #include <ripple/ledger/View.h>
 #include <ripple/ledger/CachedView.h>
@@ -192,6 +193,11 @@ pendSaveValidated(
     bool isSynchronous,
     bool isCurrent);
 extern
+bool
+saveValidatedLedgers(
+    Application& app,
+    std::vector<PendingSaves::Save> const& saves);
+extern
 std::shared_ptr<Ledger>
 loadByIndex (std::uint32_t ledgerIndex,
     Application& app, bool acquire = true);
@@ -17,7 +17,8 @@ LedgerHistory::LedgerHistory (
     , collector_ (collector)
     , mismatch_counter_ (collector->make_counter ("ledger.history", "mismatch"))
     , m_ledgers_by_hash ("LedgerCache", CACHED_LEDGER_NUM, CachedLedgerAge,
-        stopwatch(), app_.journal("TaggedCache"))
+        stopwatch(), app_.journal("TaggedCache"),
+            beast::insight::NullCollector::New (), 4)
     , m_consensus_validated ("ConsensusValidated", 64, std::chrono::minutes {5},
         stopwatch(), app_.journal("TaggedCache"))
     , j_ (app.journal ("LedgerHistory"))
@@ -31,7 +32,7 @@ LedgerHistory::insert(
     if(! ledger->isImmutable())
         LogicError("mutable Ledger in insert");
     assert (ledger->stateMap().getHash ().isNonZero ());
-    LedgersByHash::ScopedLockType sl (m_ledgers_by_hash.peekMutex ());
+    std::lock_guard <std::mutex> sl (m_index_mutex);
     const bool alreadyHad = m_ledgers_by_hash.canonicalize (
         ledger->info().hash, ledger, true);
     if (validated)
@@ -40,7 +41,7 @@ LedgerHistory::insert(
 }
 LedgerHash LedgerHistory::getLedgerHash (LedgerIndex index)
 {
-    LedgersByHash::ScopedLockType sl (m_ledgers_by_hash.peekMutex ());
+    std::lock_guard <std::mutex> sl (m_index_mutex);
     auto it = mLedgersByIndex.find (index);
     if (it != mLedgersByIndex.end ())
         return it->second;
@@ -50,7 +51,7 @@ std::shared_ptr<Ledger const>
 LedgerHistory::getLedgerBySeq (LedgerIndex index)
 {
     {
-        LedgersByHash::ScopedLockType sl (m_ledgers_by_hash.peekMutex ());
+        std::unique_lock <std::mutex> sl (m_index_mutex);
         auto it = mLedgersByIndex.find (index);
         if (it != mLedgersByIndex.end ())
         {
@@ -64,8 +65,8 @@ LedgerHistory::getLedgerBySeq (LedgerIndex index)
         return ret;
     assert (ret->info().seq == index);
     {
-        LedgersByHash::ScopedLockType sl (m_ledgers_by_hash.peekMutex ());
         assert (ret->isImmutable ());
+        std::lock_guard <std::mutex> sl (m_index_mutex);
         m_ledgers_by_hash.canonicalize (ret->info().hash, ret);
         mLedgersByIndex[ret->info().seq] = ret->info().hash;
         return (ret->info().seq == index) ? ret : nullptr;
@@ -408,7 +409,7 @@ void LedgerHistory::validatedLedger (
 bool LedgerHistory::fixIndex (
     LedgerIndex ledgerIndex, LedgerHash const& ledgerHash)
 {
-    LedgersByHash::ScopedLockType sl (m_ledgers_by_hash.peekMutex ());
+    std::lock_guard <std::mutex> sl (m_index_mutex);
     auto it = mLedgersByIndex.find (ledgerIndex);
     if ((it != mLedgersByIndex.end ()) && (it->second != ledgerHash) )
     {
@@ -2,9 +2,11 @@
 #define RIPPLE_APP_LEDGER_LEDGERHISTORY_H_INCLUDED
 #include <ripple/app/ledger/Ledger.h>
 #include <ripple/app/main/Application.h>
+#include <ripple/basics/PartitionedTaggedCache.h>
 #include <ripple/protocol/RippleLedgerHash.h>
 #include <ripple/beast/insight/Collector.h>
 #include <ripple/beast/insight/Event.h>
+#include <mutex>
 namespace ripple {
 class LedgerHistory
 {
@@ -48,7 +50,7 @@ private:
     Application& app_;
     beast::insight::Collector::ptr collector_;
     beast::insight::Counter mismatch_counter_;
-    using LedgersByHash = TaggedCache <LedgerHash, Ledger const>;
+    using LedgersByHash = PartitionedTaggedCache <LedgerHash, Ledger const>;
     LedgersByHash m_ledgers_by_hash;
     struct cv_entry
     {
@@ -60,6 +62,7 @@ private:
     };
     using ConsensusValidated = TaggedCache <LedgerIndex, cv_entry>;
     ConsensusValidated m_consensus_validated;
+    std::mutex m_index_mutex;
     std::map <LedgerIndex, LedgerHash> mLedgersByIndex; 
     beast::Journal j_;
 };
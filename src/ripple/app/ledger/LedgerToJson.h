@@ -32,6 +32,7 @@ struct LedgerFill
     LedgerEntryType type;
 };
 void addJson(Json::Value&, LedgerFill const&);
+void addJson(Json::Object&, LedgerFill const&);
 Json::Value getJson (LedgerFill const&);
 template <class Object>
 Blob serializeBlob(Object const& o)
@@ -6,6 +6,7 @@
 #include <ripple/core/Config.h>
 #include <ripple/core/JobQueue.h>
 #include <ripple/protocol/Indexes.h>
+#include <algorithm>
 namespace ripple {
 OrderBookDB::OrderBookDB (Application& app, Stoppable& parent)
     : Stoppable ("OrderBookDB", parent)
@@ -27,9 +28,7 @@ void OrderBookDB::setup(
         auto seq = ledger->info().seq;
         if (mSeq != 0)
         {
-            if (seq == mSeq)
-                return;
-            if ((seq > mSeq) && ((seq - mSeq) < 256))
+            if (seq == mSeq || seq == mSeq + 1)
                 return;
             if ((seq < mSeq) && ((mSeq - seq) < 16))
                 return;
@@ -143,6 +142,62 @@ void OrderBookDB::addOrderBook(Book const& book)
     if (toXRP)
         mXRPBooks.insert(book.in);
 }
+void OrderBookDB::removeOrderBook (Book const& book)
+{
+    auto remove = [&book](IssueToOrderBook& map, Issue const& issue)
+    {
+        auto it = map.find (issue);
+        if (it == map.end ())
+            return;
+        auto& books = it->second;
+        books.erase (std::remove_if (books.begin (), books.end (),
+            [&book](OrderBook::pointer const& ob)
+            {
+                return ob->book () == book;
+            }), books.end ());
+        if (books.empty ())
+            map.erase (it);
+    };
+    remove (mSourceMap, book.in);
+    remove (mDestMap, book.out);
+    if (isXRP (book.out))
+        mXRPBooks.erase (book.in);
+}
+void OrderBookDB::updateBooks (ReadView const& ledger, STObject const& node)
+{
+    bool const created = node.getFName () == sfCreatedNode;
+    if (! created && node.getFName () != sfDeletedNode)
+        return;
+    auto data = dynamic_cast<const STObject*> (
+        node.peekAtPField (created ? sfNewFields : sfFinalFields));
+    if (! data ||
+        ! data->isFieldPresent (sfExchangeRate) ||
+        ! data->isFieldPresent (sfRootIndex) ||
+        data->getFieldH256 (sfRootIndex) != node.getFieldH256 (sfLedgerIndex))
+    {
+        return;
+    }
+    auto field = [data](SField const& f)
+    {
+        return data->isFieldPresent (f) ? data->getFieldH160 (f) : uint160 ();
+    };
+    Book book;
+    book.in.currency = field (sfTakerPaysCurrency);
+    book.in.account = field (sfTakerPaysIssuer);
+    book.out.currency = field (sfTakerGetsCurrency);
+    book.out.account = field (sfTakerGetsIssuer);
+    if (created)
+    {
+        addOrderBook (book);
+        return;
+    }
+    auto const base = getBookBase (book);
+    if (! ledger.succ (base, getQualityNext (base)))
+    {
+        JLOG (j_.debug()) << "OrderBookDB removing empty book " << book;
+        removeOrderBook (book);
+    }
+}
 OrderBook::List OrderBookDB::getBooksByTakerPays (Issue const& issue)
 {
     std::lock_guard <std::recursive_mutex> sl (mLock);
@@ -182,13 +237,34 @@ BookListeners::pointer OrderBookDB::getBookListeners (Book const& book)
 }
 void OrderBookDB::processTxn (
     std::shared_ptr<ReadView const> const& ledger,
-        const AcceptedLedgerTx& alTx, Json::Value const& jvObj)
+        const AcceptedLedgerTx& alTx, InfoSub::Message const& msg)
 {
+    auto const meta = alTx.getMeta ();
+    if (! meta)
+        return;
     std::lock_guard <std::recursive_mutex> sl (mLock);
+    if (mSeq != 0 && ledger->info().seq > mSeq)
+        mSeq = ledger->info().seq;
+    if (mSeq != 0 && app_.config().PATH_SEARCH_MAX != 0)
+    {
+        for (auto& node : meta->getNodes ())
+        {
+            try
+            {
+                if (node.getFieldU16 (sfLedgerEntryType) == ltDIR_NODE)
+                    updateBooks (*ledger, node);
+            }
+            catch (std::exception const&)
+            {
+                JLOG (j_.info())
+                    << "Unable to track books in OrderBookDB::processTxn";
+            }
+        }
+    }
     if (alTx.getResult () == tesSUCCESS)
     {
         hash_set<std::uint64_t> havePublished;
-        for (auto& node : alTx.getMeta ()->getNodes ())
+        for (auto& node : meta->getNodes ())
         {
             try
             {
@@ -214,7 +290,7 @@ void OrderBookDB::processTxn (
                             auto listeners = getBookListeners(b);
                             if (listeners)
                             {
-                                listeners->publish(jvObj, havePublished);
+                                listeners->publish(msg, havePublished);
                             }
                         }
                     }
@@ -22,10 +22,12 @@ public:
     BookListeners::pointer makeBookListeners (Book const&);
     void processTxn (
         std::shared_ptr<ReadView const> const& ledger,
-        const AcceptedLedgerTx& alTx, Json::Value const& jvObj);
+        const AcceptedLedgerTx& alTx, InfoSub::Message const& msg);
     using IssueToOrderBook = hash_map <Issue, OrderBook::List>;
 private:
     void rawAddBook(Book const&);
+    void removeOrderBook (Book const&);
+    void updateBooks (ReadView const& ledger, STObject const& node);
     Application& app_;
     IssueToOrderBook mSourceMap;
     IssueToOrderBook mDestMap;
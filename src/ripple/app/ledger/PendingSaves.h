@@ -1,16 +1,36 @@
 #ifndef RIPPLE_APP_PENDINGSAVES_H_INCLUDED
 #define RIPPLE_APP_PENDINGSAVES_H_INCLUDED
 #include <ripple/protocol/Protocol.h>
+#include <deque>
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <utility>
+#include <vector>
 namespace ripple {
+class Ledger;
 class PendingSaves
 {
+public:
+    using Save = std::pair <std::shared_ptr <Ledger const>, bool>;
 private:
     std::mutex mutable mutex_;
     std::map <LedgerIndex, bool> map_;
     std::condition_variable await_;
+    std::deque <Save> current_;
+    std::deque <Save> history_;
+    std::size_t writers_ = 0;
+    bool currentWriter_ = false;
+    void
+    releaseWriter (bool isCurrent)
+    {
+        if (writers_ != 0)
+            --writers_;
+        if (isCurrent)
+            currentWriter_ = false;
+    }
 public:
     bool
     startWork (LedgerIndex seq)
@@ -60,6 +80,55 @@ public:
             await_.wait (lock);
         } while (true);
     }
+    bool
+    enqueue (std::shared_ptr <Ledger const> const& ledger, bool isCurrent)
+    {
+        std::lock_guard <std::mutex> lock(mutex_);
+        (isCurrent ? current_ : history_).emplace_back (ledger, isCurrent);
+        if (isCurrent ? currentWriter_ : (writers_ != 0))
+            return false;
+        ++writers_;
+        if (isCurrent)
+            currentWriter_ = true;
+        return true;
+    }
+    std::vector <Save>
+    takeBatch (std::size_t limit)
+    {
+        std::lock_guard <std::mutex> lock(mutex_);
+        std::vector <Save> batch;
+        batch.reserve (std::min (limit, current_.size () + history_.size ()));
+        for (auto queue : {&current_, &history_})
+        {
+            while (batch.size () < limit && ! queue->empty ())
+            {
+                batch.push_back (std::move (queue->front ()));
+                queue->pop_front ();
+            }
+        }
+        return batch;
+    }
+    bool
+    stopWriting (bool isCurrent)
+    {
+        std::lock_guard <std::mutex> lock(mutex_);
+        if (! current_.empty () || ! history_.empty ())
+            return false;
+        releaseWriter (isCurrent);
+        return true;
+    }
+    void
+    abortWriting (bool isCurrent)
+    {
+        std::lock_guard <std::mutex> lock(mutex_);
+        releaseWriter (isCurrent);
+    }
+    std::size_t
+    queued () const
+    {
+        std::lock_guard <std::mutex> lock(mutex_);
+        return current_.size () + history_.size ();
+    }
     std::map <LedgerIndex, bool>
     getSnapshot () const
     {
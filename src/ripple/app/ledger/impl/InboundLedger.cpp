@@ -159,8 +159,8 @@ InboundLedger::~InboundLedger ()
     }
 }
 std::vector<uint256>
-InboundLedger::neededTxHashes (
-    int max, SHAMapSyncFilter* filter) const
+InboundLedger::neededTxHashes (int max, SHAMapSyncFilter* filter,
+    NodeStore::ReadPriority priority) const
 {
     std::vector<uint256> ret;
     if (mLedger->info().txHash.isNonZero ())
@@ -168,13 +168,13 @@ InboundLedger::neededTxHashes (
         if (mLedger->txMap().getHash().isZero ())
             ret.push_back (mLedger->info().txHash);
         else
-            ret = mLedger->txMap().getNeededHashes (max, filter);
+            ret = mLedger->txMap().getNeededHashes (max, filter, priority);
     }
     return ret;
 }
 std::vector<uint256>
-InboundLedger::neededStateHashes (
-    int max, SHAMapSyncFilter* filter) const
+InboundLedger::neededStateHashes (int max, SHAMapSyncFilter* filter,
+    NodeStore::ReadPriority priority) const
 {
     std::vector<uint256> ret;
     if (mLedger->info().accountHash.isNonZero ())
@@ -182,7 +182,7 @@ InboundLedger::neededStateHashes (
         if (mLedger->stateMap().getHash().isZero ())
             ret.push_back (mLedger->info().accountHash);
         else
-            ret = mLedger->stateMap().getNeededHashes (max, filter);
+            ret = mLedger->stateMap().getNeededHashes (max, filter, priority);
     }
     return ret;
 }
@@ -270,7 +270,7 @@ InboundLedger::tryDB(Family& f)
             if (mLedger->txMap().fetchRoot(
                 SHAMapHash{mLedger->info().txHash}, &filter))
             {
-                if (neededTxHashes(1, &filter).empty())
+                if (neededTxHashes(1, &filter, readPriority()).empty())
                 {
                     JLOG(m_journal.trace()) <<
                         "Had full txn map locally";
@@ -293,7 +293,7 @@ InboundLedger::tryDB(Family& f)
         if (mLedger->stateMap().fetchRoot(
             SHAMapHash{mLedger->info().accountHash}, &filter))
         {
-            if (neededStateHashes(1, &filter).empty())
+            if (neededStateHashes(1, &filter, readPriority()).empty())
             {
                 JLOG(m_journal.trace()) <<
                     "Had full AS map locally";
@@ -544,7 +544,7 @@ void InboundLedger::trigger (std::shared_ptr<Peer> const& peer, TriggerReason re
                 app_.getLedgerMaster());
             sl.unlock();
             auto nodes = mLedger->stateMap().getMissingNodes (
-                missingNodesFind, &filter);
+                missingNodesFind, &filter, readPriority());
             sl.lock();
             if (!mFailed && !mComplete && !mHaveState)
             {
@@ -607,7 +607,7 @@ void InboundLedger::trigger (std::shared_ptr<Peer> const& peer, TriggerReason re
             TransactionStateSF filter(mLedger->txMap().family().db(),
                 app_.getLedgerMaster());
             auto nodes = mLedger->txMap().getMissingNodes (
-                missingNodesFind, &filter);
+                missingNodesFind, &filter, readPriority());
             if (nodes.empty ())
             {
                 if (!mLedger->txMap().isValid ())
@@ -882,6 +882,20 @@ bool InboundLedger::takeTxRootNode (Slice const& data, SHAMapAddNode& san)
         SHAMapHash{mLedger->info().txHash}, data, snfWIRE, &filter);
     return san.isGood();
 }
+NodeStore::ReadPriority
+InboundLedger::readPriority () const
+{
+    switch (mReason)
+    {
+    case Reason::HISTORY:
+    case Reason::SHARD:
+        return NodeStore::ReadPriority::history;
+    case Reason::CLIENT:
+        return NodeStore::ReadPriority::client;
+    default:
+        return NodeStore::ReadPriority::critical;
+    }
+}
 std::vector<InboundLedger::neededHash_t>
 InboundLedger::getNeededHashes ()
 {
@@ -896,7 +910,7 @@ InboundLedger::getNeededHashes ()
     {
         AccountStateSF filter(mLedger->stateMap().family().db(),
             app_.getLedgerMaster());
-        for (auto const& h : neededStateHashes (4, &filter))
+        for (auto const& h : neededStateHashes (4, &filter, readPriority()))
         {
             ret.push_back (std::make_pair (
                 protocol::TMGetObjectByHash::otSTATE_NODE, h));
@@ -906,7 +920,7 @@ InboundLedger::getNeededHashes ()
     {
         TransactionStateSF filter(mLedger->txMap().family().db(),
             app_.getLedgerMaster());
-        for (auto const& h : neededTxHashes (4, &filter))
+        for (auto const& h : neededTxHashes (4, &filter, readPriority()))
         {
             ret.push_back (std::make_pair (
                 protocol::TMGetObjectByHash::otTRANSACTION_NODE, h));
@@ -1076,7 +1090,8 @@ Json::Value InboundLedger::getJson (int)
     if (mHaveHeader && !mHaveState)
     {
         Json::Value hv (Json::arrayValue);
-        for (auto const& h : neededStateHashes (16, nullptr))
+        for (auto const& h : neededStateHashes (
+            16, nullptr, NodeStore::ReadPriority::client))
         {
             hv.append (to_string (h));
         }
@@ -1085,7 +1100,8 @@ Json::Value InboundLedger::getJson (int)
     if (mHaveHeader && !mHaveTransactions)
     {
         Json::Value hv (Json::arrayValue);
-        for (auto const& h : neededTxHashes (16, nullptr))
+        for (auto const& h : neededTxHashes (
+            16, nullptr, NodeStore::ReadPriority::client))
         {
             hv.append (to_string (h));
         }
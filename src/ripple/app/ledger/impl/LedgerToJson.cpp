@@ -201,14 +201,25 @@ void fillJson (Object& json, LedgerFill const& fill)
     if (bFull || fill.options & LedgerFill::dumpState)
         fillJsonState(json, fill);
 }
-} 
-void addJson (Json::Value& json, LedgerFill const& fill)
+template <class Object>
+void addJsonImpl (Object& json, LedgerFill const& fill)
 {
-    auto&& object = Json::addObject (json, jss::ledger);
-    fillJson (object, fill);
+    {
+        auto&& object = Json::addObject (json, jss::ledger);
+        fillJson (object, fill);
+    }
     if ((fill.options & LedgerFill::dumpQueue) && !fill.txQueue.empty())
         fillJsonQueue(json, fill);
 }
+} 
+void addJson (Json::Value& json, LedgerFill const& fill)
+{
+    addJsonImpl (json, fill);
+}
+void addJson (Json::Object& json, LedgerFill const& fill)
+{
+    addJsonImpl (json, fill);
+}
 Json::Value getJson (LedgerFill const& fill)
 {
     Json::Value json;
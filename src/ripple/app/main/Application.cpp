@@ -18,6 +18,7 @@
 #include <ripple/app/main/NodeStoreScheduler.h>
 #include <ripple/app/misc/AmendmentTable.h>
 #include <ripple/app/misc/HashRouter.h>
+#include <ripple/app/misc/SignatureVerifier.h>
 #include <ripple/app/misc/LoadFeeTrack.h>
 #include <ripple/app/misc/NetworkOPs.h>
 #include <ripple/app/misc/SHAMapStore.h>
@@ -61,6 +62,7 @@ private:
     FullBelowCache fullbelow_;
     NodeStore::Database& db_;
     bool const shardBacked_;
+    std::size_t const flushThreads_;
     beast::Journal j_;
     LedgerIndex maxSeq = 0;
     std::mutex maxSeqLock;
@@ -93,6 +95,7 @@ public:
         , db_ (db)
         , shardBacked_ (
             dynamic_cast<NodeStore::DatabaseShard*>(&db) != nullptr)
+        , flushThreads_ (app.config().SHAMAP_FLUSH_THREADS)
         , j_ (app.journal("SHAMap"))
     {
     }
@@ -136,6 +139,17 @@ public:
     {
         return shardBacked_;
     }
+    std::size_t
+    flushThreads() const override
+    {
+        return flushThreads_;
+    }
+    void
+    addFlushJob (std::function<void()> job) override
+    {
+        app_.getJobQueue().addJob (jtSHAMAP_FLUSH, "SHAMap::flush",
+            [job] (Job&) { job (); });
+    }
     void
     missing_node (std::uint32_t seq) override
     {
@@ -278,6 +292,7 @@ public:
     std::unique_ptr <AmendmentTable> m_amendmentTable;
     std::unique_ptr <LoadFeeTrack> mFeeTrack;
     std::unique_ptr <HashRouter> mHashRouter;
+    std::unique_ptr <SignatureVerifier> signatureVerifier_;
     RCLValidations mValidations;
     std::unique_ptr <LoadManager> m_loadManager;
     std::unique_ptr <TxQ> txQ_;
@@ -383,6 +398,9 @@ public:
         , mHashRouter (std::make_unique<HashRouter>(
             stopwatch(), HashRouter::getDefaultHoldTime (),
             HashRouter::getDefaultRecoverLimit ()))
+        , signatureVerifier_ (std::make_unique<SignatureVerifier>(*m_jobQueue,
+            config_->SIG_VERIFY_THREADS ? config_->SIG_VERIFY_THREADS :
+                std::thread::hardware_concurrency() / 2))
         , mValidations (ValidationParms(),stopwatch(), *this, logs_->journal("Validations"))
         , m_loadManager (make_LoadManager (*this, *this, logs_->journal("LoadManager")))
         , txQ_(make_TxQ(setup_TxQ(*config_), logs_->journal("TxQ")))
@@ -541,6 +559,10 @@ public:
     {
         return *mHashRouter;
     }
+    SignatureVerifier& getSignatureVerifier () override
+    {
+        return *signatureVerifier_;
+    }
     RCLValidations& getValidations () override
     {
         return mValidations;
@@ -19,6 +19,7 @@ class CachedSLEs;
 class CollectorManager;
 class Family;
 class HashRouter;
+class SignatureVerifier;
 class Logs;
 class LoadFeeTrack;
 class JobQueue;
@@ -80,6 +81,7 @@ public:
     virtual CachedSLEs&                 cachedSLEs() = 0;
     virtual AmendmentTable&             getAmendmentTable() = 0;
     virtual HashRouter&                 getHashRouter () = 0;
+    virtual SignatureVerifier&          getSignatureVerifier () = 0;
     virtual LoadFeeTrack&               getFeeTrack () = 0;
     virtual LoadManager&                getLoadManager () = 0;
     virtual Overlay&                    overlay () = 0;
@@ -1,39 +1,52 @@
 
 #include <ripple/app/misc/HashRouter.h>
+#include <cstring>
 namespace ripple {
 auto
-HashRouter::emplace (uint256 const& key)
+HashRouter::shard (uint256 const& key)
+    -> Shard&
+{
+    std::uint32_t prefix;
+    std::memcpy (&prefix, key.data (), sizeof (prefix));
+    return *shards_[prefix % shards_.size ()];
+}
+auto
+HashRouter::emplace (Shard& shard, uint256 const& key)
     -> std::pair<Entry&, bool>
 {
-    auto iter = suppressionMap_.find (key);
-    if (iter != suppressionMap_.end ())
+    auto& suppressionMap = shard.suppressionMap;
+    auto iter = suppressionMap.find (key);
+    if (iter != suppressionMap.end ())
     {
-        suppressionMap_.touch(iter);
+        suppressionMap.touch(iter);
         return std::make_pair(
             std::ref(iter->second), false);
     }
-    expire(suppressionMap_, holdTime_);
+    expire(suppressionMap, holdTime_);
     return std::make_pair(std::ref(
-        suppressionMap_.emplace (
+        suppressionMap.emplace (
             key, Entry ()).first->second),
                 true);
 }
 void HashRouter::addSuppression (uint256 const& key)
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    emplace (key);
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    emplace (sh, key);
 }
 bool HashRouter::addSuppressionPeer (uint256 const& key, PeerShortID peer)
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    auto result = emplace(key);
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    auto result = emplace(sh, key);
     result.first.addPeer(peer);
     return result.second;
 }
 bool HashRouter::addSuppressionPeer (uint256 const& key, PeerShortID peer, int& flags)
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    auto result = emplace(key);
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    auto result = emplace(sh, key);
     auto& s = result.first;
     s.addPeer (peer);
     flags = s.getFlags ();
@@ -42,23 +55,26 @@ bool HashRouter::addSuppressionPeer (uint256 const& key, PeerShortID peer, int&
 bool HashRouter::shouldProcess (uint256 const& key, PeerShortID peer,
     int& flags, std::chrono::seconds tx_interval)
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    auto result = emplace(key);
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    auto result = emplace(sh, key);
     auto& s = result.first;
     s.addPeer (peer);
     flags = s.getFlags ();
-    return s.shouldProcess (suppressionMap_.clock().now(), tx_interval);
+    return s.shouldProcess (sh.suppressionMap.clock().now(), tx_interval);
 }
 int HashRouter::getFlags (uint256 const& key)
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    return emplace(key).first.getFlags ();
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    return emplace(sh, key).first.getFlags ();
 }
 bool HashRouter::setFlags (uint256 const& key, int flags)
 {
     assert (flags != 0);
-    std::lock_guard <std::mutex> lock (mutex_);
-    auto& s = emplace(key).first;
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    auto& s = emplace(sh, key).first;
     if ((s.getFlags () & flags) == flags)
         return false;
     s.setFlags (flags);
@@ -68,17 +84,19 @@ auto
 HashRouter::shouldRelay (uint256 const& key)
     -> boost::optional<std::set<PeerShortID>>
 {
-    std::lock_guard <std::mutex> lock (mutex_);
-    auto& s = emplace(key).first;
-    if (!s.shouldRelay(suppressionMap_.clock().now(), holdTime_))
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock (sh.mutex);
+    auto& s = emplace(sh, key).first;
+    if (!s.shouldRelay(sh.suppressionMap.clock().now(), holdTime_))
         return boost::none;
     return s.releasePeerSet();
 }
 bool
 HashRouter::shouldRecover(uint256 const& key)
 {
-    std::lock_guard <std::mutex> lock(mutex_);
-    auto& s = emplace(key).first;
+    auto& sh = shard (key);
+    std::lock_guard <std::mutex> lock(sh.mutex);
+    auto& s = emplace(sh, key).first;
     return s.shouldRecover(recoverLimit_);
 }
 } 
@@ -6,6 +6,9 @@
 #include <ripple/basics/UnorderedContainers.h>
 #include <ripple/beast/container/aged_unordered_map.h>
 #include <boost/optional.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
 namespace ripple {
 #define SF_BAD          0x02    
 #define SF_SAVED        0x04
@@ -81,12 +84,15 @@ public:
     {
         return 1;
     }
+    static std::size_t constexpr shardCount = 32;
     HashRouter (Stopwatch& clock, std::chrono::seconds entryHoldTimeInSeconds,
         std::uint32_t recoverLimit)
-        : suppressionMap_(clock)
-        , holdTime_ (entryHoldTimeInSeconds)
+        : holdTime_ (entryHoldTimeInSeconds)
         , recoverLimit_ (recoverLimit + 1u)
     {
+        shards_.reserve (shardCount);
+        for (std::size_t i = 0; i < shardCount; ++i)
+            shards_.push_back (std::make_unique<Shard> (clock));
     }
     HashRouter& operator= (HashRouter const&) = delete;
     virtual ~HashRouter() = default;
@@ -101,10 +107,19 @@ public:
     boost::optional<std::set<PeerShortID>> shouldRelay(uint256 const& key);
     bool shouldRecover(uint256 const& key);
 private:
-    std::pair<Entry&, bool> emplace (uint256 const&);
-    std::mutex mutable mutex_;
-    beast::aged_unordered_map<uint256, Entry, Stopwatch::clock_type,
-        hardened_hash<strong_hash>> suppressionMap_;
+    struct Shard
+    {
+        explicit Shard (Stopwatch& clock)
+            : suppressionMap (clock)
+        {
+        }
+        std::mutex mutex;
+        beast::aged_unordered_map<uint256, Entry, Stopwatch::clock_type,
+            hardened_hash<strong_hash>> suppressionMap;
+    };
+    Shard& shard (uint256 const& key);
+    std::pair<Entry&, bool> emplace (Shard& shard, uint256 const&);
+    std::vector<std::unique_ptr<Shard>> shards_;
     std::chrono::seconds const holdTime_;
     std::uint32_t const recoverLimit_;
 };
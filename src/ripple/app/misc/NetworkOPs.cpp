@@ -15,6 +15,7 @@
 #include <ripple/app/main/LoadManager.h>
 #include <ripple/app/misc/HashRouter.h>
 #include <ripple/app/misc/LoadFeeTrack.h>
+#include <ripple/app/misc/SHAMapStore.h>
 #include <ripple/app/misc/Transaction.h>
 #include <ripple/app/misc/TxQ.h>
 #include <ripple/app/misc/ValidatorKeys.h>
@@ -350,14 +351,15 @@ private:
     void setMode (OperatingMode);
     Json::Value transJson (
         const STTx& stTxn, TER terResult, bool bValidated,
-        std::shared_ptr<ReadView const> const& lpCurrent);
+        std::shared_ptr<ReadView const> const& lpCurrent,
+        bool binary = false);
     void pubValidatedTransaction (
         std::shared_ptr<ReadView const> const& alAccepted,
         const AcceptedLedgerTx& alTransaction);
     void pubAccountTransaction (
-        std::shared_ptr<ReadView const> const& lpCurrent,
         const AcceptedLedgerTx& alTransaction,
-        bool isAccepted);
+        bool isAccepted,
+        InfoSub::Message const& msg);
     void pubServer ();
     std::string getHostId (bool forAdmin);
 private:
@@ -1152,12 +1154,13 @@ void NetworkOPsImp::pubManifest (Manifest const& mo)
         if (auto sig = mo.getSignature())
             jvObj [jss::signature] = strHex (*sig);
         jvObj [jss::master_signature] = strHex (mo.getMasterSignature ());
+        InfoSub::Message const msg (jvObj);
         for (auto i = mStreamMaps[sManifests].begin ();
             i != mStreamMaps[sManifests].end (); )
         {
             if (auto p = i->second.lock())
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++i;
             }
             else
@@ -1228,13 +1231,14 @@ void NetworkOPsImp::pubServer ()
         else
             jvObj [jss::load_factor] = f.loadFactorServer;
         mLastFeeSummary = f;
+        InfoSub::Message const msg (jvObj);
         for (auto i = mStreamMaps[sServer].begin ();
             i != mStreamMaps[sServer].end (); )
         {
             InfoSub::pointer p = i->second.lock ();
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++i;
             }
             else
@@ -1277,12 +1281,13 @@ void NetworkOPsImp::pubValidation (STValidation::ref val)
             jvObj [jss::reserve_base] = *reserveBase;
         if (auto const reserveInc = (*val)[~sfReserveIncrement])
             jvObj [jss::reserve_inc] = *reserveInc;
+        InfoSub::Message const msg (jvObj);
         for (auto i = mStreamMaps[sValidations].begin ();
             i != mStreamMaps[sValidations].end (); )
         {
             if (auto p = i->second.lock())
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++i;
             }
             else
@@ -1300,13 +1305,14 @@ void NetworkOPsImp::pubPeerStatus (
     {
         Json::Value jvObj (func());
         jvObj [jss::type]                  = "peerStatusChange";
+        InfoSub::Message const msg (jvObj);
         for (auto i = mStreamMaps[sPeerStatus].begin ();
             i != mStreamMaps[sPeerStatus].end (); )
         {
             InfoSub::pointer p = i->second.lock ();
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++i;
             }
             else
@@ -1665,7 +1671,12 @@ Json::Value NetworkOPsImp::getServerInfo (bool human, bool admin, bool counters)
     }
     info[jss::last_close] = lastClose;
     if (admin)
+    {
         info[jss::load] = m_job_queue.getJson ();
+        auto copy = app_.getSHAMapStore().copyProgress();
+        if (! copy.isNull())
+            info[jss::online_delete] = std::move (copy);
+    }
     auto const escalationMetrics = app_.getTxQ().getMetrics(
         *app_.openLedger().current());
     auto const loadFactorServer = app_.getFeeTrack().getLoadFactor();
@@ -1814,7 +1825,9 @@ void NetworkOPsImp::pubProposedTransaction (
     std::shared_ptr<ReadView const> const& lpCurrent,
     std::shared_ptr<STTx const> const& stTxn, TER terResult)
 {
-    Json::Value jvObj   = transJson (*stTxn, terResult, false, lpCurrent);
+    InfoSub::Message const msg (
+        [&]{ return transJson (*stTxn, terResult, false, lpCurrent); },
+        [&]{ return transJson (*stTxn, terResult, false, lpCurrent, true); });
     {
         ScopedLockType sl (mSubLock);
         auto it = mStreamMaps[sRTTransactions].begin ();
@@ -1823,7 +1836,7 @@ void NetworkOPsImp::pubProposedTransaction (
             InfoSub::pointer p = it->second.lock ();
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++it;
             }
             else
@@ -1835,7 +1848,7 @@ void NetworkOPsImp::pubProposedTransaction (
     AcceptedLedgerTx alt (lpCurrent, stTxn, terResult,
         app_.accountIDCache(), app_.logs());
     JLOG(m_journal.trace()) << "pubProposed: " << alt.getJson ();
-    pubAccountTransaction (lpCurrent, alt, false);
+    pubAccountTransaction (alt, false, msg);
 }
 void NetworkOPsImp::pubLedger (
     std::shared_ptr<ReadView const> const& lpAccepted)
@@ -1870,13 +1883,14 @@ void NetworkOPsImp::pubLedger (
                 jvObj[jss::validated_ledgers]
                         = app_.getLedgerMaster ().getCompleteLedgers ();
             }
+            InfoSub::Message const msg (jvObj);
             auto it = mStreamMaps[sLedger].begin ();
             while (it != mStreamMaps[sLedger].end ())
             {
                 InfoSub::pointer p = it->second.lock ();
                 if (p)
                 {
-                    p->send (jvObj, true);
+                    p->send (msg, true);
                     ++it;
                 }
                 else
@@ -1904,14 +1918,15 @@ void NetworkOPsImp::reportFeeChange ()
 }
 Json::Value NetworkOPsImp::transJson(
     const STTx& stTxn, TER terResult, bool bValidated,
-    std::shared_ptr<ReadView const> const& lpCurrent)
+    std::shared_ptr<ReadView const> const& lpCurrent,
+    bool binary)
 {
     Json::Value jvObj (Json::objectValue);
     std::string sToken;
     std::string sHuman;
     transResultInfo (terResult, sToken, sHuman);
     jvObj[jss::type]           = "transaction";
-    jvObj[jss::transaction]    = stTxn.getJson (JsonOptions::none);
+    jvObj[jss::transaction]    = stTxn.getJson (JsonOptions::none, binary);
     if (bValidated)
     {
         jvObj[jss::ledger_index]           = lpCurrent->info().seq;
@@ -1947,14 +1962,28 @@ void NetworkOPsImp::pubValidatedTransaction (
     const AcceptedLedgerTx& alTx)
 {
     std::shared_ptr<STTx const> stTxn = alTx.getTxn();
-    Json::Value jvObj = transJson (
-        *stTxn, alTx.getResult (), true, alAccepted);
-    if (auto const txMeta = alTx.getMeta())
+    auto build = [&](bool binary)
     {
-        jvObj[jss::meta] = txMeta->getJson(JsonOptions::none);
-        RPC::insertDeliveredAmount(
-            jvObj[jss::meta], *alAccepted, stTxn, *txMeta);
-    }
+        Json::Value jvObj = transJson (
+            *stTxn, alTx.getResult (), true, alAccepted, binary);
+        if (auto const txMeta = alTx.getMeta())
+        {
+            if (binary)
+            {
+                jvObj[jss::meta] = strHex (alTx.getRawMeta ());
+            }
+            else
+            {
+                jvObj[jss::meta] = txMeta->getJson(JsonOptions::none);
+                RPC::insertDeliveredAmount(
+                    jvObj[jss::meta], *alAccepted, stTxn, *txMeta);
+            }
+        }
+        return jvObj;
+    };
+    InfoSub::Message const msg (
+        [&]{ return build (false); },
+        [&]{ return build (true); });
     {
         ScopedLockType sl (mSubLock);
         auto it = mStreamMaps[sTransactions].begin ();
@@ -1963,7 +1992,7 @@ void NetworkOPsImp::pubValidatedTransaction (
             InfoSub::pointer p = it->second.lock ();
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++it;
             }
             else
@@ -1975,20 +2004,20 @@ void NetworkOPsImp::pubValidatedTransaction (
             InfoSub::pointer p = it->second.lock ();
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (msg, true);
                 ++it;
             }
             else
                 it = mStreamMaps[sRTTransactions].erase (it);
         }
     }
-    app_.getOrderBookDB ().processTxn (alAccepted, alTx, jvObj);
-    pubAccountTransaction (alAccepted, alTx, true);
+    app_.getOrderBookDB ().processTxn (alAccepted, alTx, msg);
+    pubAccountTransaction (alTx, true, msg);
 }
 void NetworkOPsImp::pubAccountTransaction (
-    std::shared_ptr<ReadView const> const& lpCurrent,
     const AcceptedLedgerTx& alTx,
-    bool bAccepted)
+    bool bAccepted,
+    InfoSub::Message const& msg)
 {
     hash_set<InfoSub::pointer>  notify;
     int                             iProposed   = 0;
@@ -2044,23 +2073,8 @@ void NetworkOPsImp::pubAccountTransaction (
     JLOG(m_journal.trace()) << "pubAccountTransaction:" <<
         " iProposed=" << iProposed <<
         " iAccepted=" << iAccepted;
-    if (!notify.empty ())
-    {
-        std::shared_ptr<STTx const> stTxn = alTx.getTxn();
-        Json::Value jvObj = transJson (
-            *stTxn, alTx.getResult (), bAccepted, lpCurrent);
-        if (alTx.isApplied ())
-        {
-            if (auto const txMeta = alTx.getMeta())
-            {
-                jvObj[jss::meta] = txMeta->getJson(JsonOptions::none);
-                RPC::insertDeliveredAmount(
-                    jvObj[jss::meta], *lpCurrent, stTxn, *txMeta);
-            }
-        }
-        for (InfoSub::ref isrListener : notify)
-            isrListener->send (jvObj, true);
-    }
+    for (InfoSub::ref isrListener : notify)
+        isrListener->send (msg, true);
 }
 void NetworkOPsImp::subAccount (
     InfoSub::ref isrListener,
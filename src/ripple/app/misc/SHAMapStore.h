@@ -22,6 +22,7 @@ public:
         std::uint32_t deleteBatch = 100;
         std::uint32_t backOff = 100;
         std::int32_t ageThreshold = 60;
+        std::uint32_t copyThreads = 4;
         Section shardDatabase;
     };
     SHAMapStore (Stoppable& parent) : Stoppable ("SHAMapStore", parent) {}
@@ -39,6 +40,7 @@ public:
     virtual LedgerIndex getLastRotated() = 0;
     virtual LedgerIndex getCanDelete() = 0;
     virtual int fdlimit() const = 0;
+    virtual Json::Value copyProgress() const = 0;
 };
 SHAMapStore::Setup
 setup_SHAMapStore(Config const& c);
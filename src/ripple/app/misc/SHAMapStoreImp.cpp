@@ -6,6 +6,9 @@
 #include <ripple/core/ConfigSections.h>
 #include <ripple/nodestore/impl/DatabaseRotatingImp.h>
 #include <ripple/nodestore/impl/DatabaseShardImp.h>
+#include <ripple/protocol/jss.h>
+#include <exception>
+#include <vector>
 namespace ripple {
 void SHAMapStoreImp::SavedStateDB::init (BasicConfig const& config,
                                          std::string const& dbName)
@@ -269,17 +272,170 @@ SHAMapStoreImp::fdlimit () const
 {
     return fdlimit_;
 }
+Json::Value
+SHAMapStoreImp::copyProgress() const
+{
+    using namespace std::chrono;
+    Json::Value ret;
+    std::lock_guard <std::mutex> lock (mutex_);
+    if (! copyState_.seq)
+        return ret;
+    auto const elapsed = copyState_.copying ?
+        steady_clock::now() - copyState_.start : copyState_.elapsed;
+    auto const nodes = copiedNodes_.load();
+    if (copyState_.copying)
+        ret[jss::status] = "copying";
+    else if (copyState_.interrupted)
+        ret[jss::status] = "interrupted";
+    else
+        ret[jss::status] = "complete";
+    ret[jss::ledger_index] = copyState_.seq;
+    ret[jss::type] = copyState_.incremental ? "incremental" : "full";
+    ret[jss::nodes] = std::to_string (nodes);
+    ret[jss::duration_us] = std::to_string (
+        duration_cast<microseconds> (elapsed).count());
+    auto const seconds = duration_cast<duration<double>> (elapsed).count();
+    if (seconds > 0)
+        ret[jss::nodes_per_second] = static_cast<Json::UInt> (nodes / seconds);
+    return ret;
+}
+bool
+SHAMapStoreImp::copyBatch (std::vector<uint256>& batch, LedgerIndex seq,
+    std::uint64_t& sinceCheck)
+{
+    dbRotating_->fetchBatch (batch, seq);
+    copiedNodes_ += batch.size();
+    sinceCheck += batch.size();
+    batch.clear();
+    if (sinceCheck < checkHealthInterval_)
+        return true;
+    sinceCheck = 0;
+    return health() == Health::ok;
+}
+bool
+SHAMapStoreImp::copyDifferences (SHAMap const& map, LedgerIndex seq)
+{
+    std::vector<uint256> batch;
+    batch.reserve (copyBatchSize_);
+    std::uint64_t sinceCheck = 0;
+    bool healthy = true;
+    map.visitDifferences (lastCopy_.get(),
+        [&](SHAMapAbstractNode& node)
+        {
+            batch.push_back (node.getNodeHash().as_uint256());
+            if (batch.size() >= copyBatchSize_)
+                healthy = copyBatch (batch, seq, sinceCheck);
+            return healthy;
+        });
+    if (healthy && ! batch.empty())
+        healthy = copyBatch (batch, seq, sinceCheck);
+    return healthy;
+}
 bool
-SHAMapStoreImp::copyNode (std::uint64_t& nodeCount,
-        SHAMapAbstractNode const& node)
+SHAMapStoreImp::copyBranches (SHAMap const& map, LedgerIndex seq)
 {
-    dbRotating_->fetch(node.getNodeHash().as_uint256(), node.getSeq());
-    if (! (++nodeCount % checkHealthInterval_))
+    std::atomic<int> nextBranch {0};
+    std::atomic<bool> interrupted {false};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto copy = [&]()
     {
-        if (health())
-            return false;
+        try
+        {
+            std::vector<uint256> batch;
+            batch.reserve (copyBatchSize_);
+            std::uint64_t sinceCheck = 0;
+            auto flush = [&]()
+            {
+                if (! copyBatch (batch, seq, sinceCheck))
+                    interrupted = true;
+                return ! interrupted;
+            };
+            for (int branch = nextBranch++; branch < 16 && ! interrupted;
+                branch = nextBranch++)
+            {
+                bool const complete = map.visitBranch (branch,
+                    [&](SHAMapAbstractNode& node)
+                    {
+                        batch.push_back (node.getNodeHash().as_uint256());
+                        return batch.size() < copyBatchSize_ || flush();
+                    });
+                if (complete && ! batch.empty())
+                    flush();
+            }
+        }
+        catch (...)
+        {
+            interrupted = true;
+            std::lock_guard <std::mutex> lock (errorMutex);
+            if (! error)
+                error = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve (setup_.copyThreads);
+    for (std::uint32_t i = 1; i < setup_.copyThreads; ++i)
+    {
+        workers.emplace_back ([&]()
+        {
+            beast::setCurrentThreadName ("SHAMapStore copy");
+            copy();
+        });
     }
-    return true;
+    copy();
+    for (auto& worker : workers)
+        worker.join();
+    if (error)
+        std::rethrow_exception (error);
+    return ! interrupted;
+}
+void
+SHAMapStoreImp::copyState (
+    std::shared_ptr<SHAMap const> const& map, LedgerIndex seq)
+{
+    auto const backend = dbRotating_->getWritableBackend()->getName();
+    bool const incremental = lastCopy_ && lastCopyBackend_ == backend;
+    {
+        std::lock_guard <std::mutex> lock (mutex_);
+        copyState_.seq = seq;
+        copyState_.copying = true;
+        copyState_.interrupted = false;
+        copyState_.incremental = incremental;
+        copyState_.start = std::chrono::steady_clock::now();
+    }
+    copiedNodes_ = 0;
+    bool complete = false;
+    try
+    {
+        if (incremental)
+        {
+            complete = copyDifferences (*map, seq);
+        }
+        else
+        {
+            ++copiedNodes_;
+            dbRotating_->fetch (map->getHash().as_uint256(), seq);
+            complete = copyBranches (*map, seq);
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard <std::mutex> lock (mutex_);
+        copyState_.copying = false;
+        copyState_.interrupted = true;
+        copyState_.elapsed =
+            std::chrono::steady_clock::now() - copyState_.start;
+        throw;
+    }
+    if (complete)
+    {
+        lastCopy_ = map;
+        lastCopyBackend_ = backend;
+    }
+    std::lock_guard <std::mutex> lock (mutex_);
+    copyState_.copying = false;
+    copyState_.interrupted = ! complete;
+    copyState_.elapsed = std::chrono::steady_clock::now() - copyState_.start;
 }
 void
 SHAMapStoreImp::run()
@@ -350,13 +506,10 @@ SHAMapStoreImp::run()
                 default:
                     ;
             }
-            std::uint64_t nodeCount = 0;
-            validatedLedger->stateMap().snapShot (
-                    false)->visitNodes (
-                    std::bind (&SHAMapStoreImp::copyNode, this,
-                    std::ref(nodeCount), std::placeholders::_1));
+            copyState (validatedLedger->stateMap().snapShot (false),
+                validatedSeq);
             JLOG(journal_.debug()) << "copied ledger " << validatedSeq
-                    << " nodecount " << nodeCount;
+                    << " nodecount " << copiedNodes_;
             switch (health())
             {
                 case Health::stopping:
@@ -408,6 +561,7 @@ SHAMapStoreImp::run()
                 oldBackend = dbRotating_->rotateBackends(
                     std::move(newBackend));
             }
+            lastCopy_.reset();
             JLOG(journal_.debug()) << "finished rotation " << validatedSeq;
             oldBackend->setDeletePath();
         }
@@ -704,6 +858,9 @@ setup_SHAMapStore (Config const& c)
     get_if_exists (setup.nodeDatabase, "delete_batch", setup.deleteBatch);
     get_if_exists (setup.nodeDatabase, "backOff", setup.backOff);
     get_if_exists (setup.nodeDatabase, "age_threshold", setup.ageThreshold);
+    get_if_exists (setup.nodeDatabase, "copy_threads", setup.copyThreads);
+    setup.copyThreads = std::max<std::uint32_t> (1,
+        std::min<std::uint32_t> (setup.copyThreads, 16));
     setup.shardDatabase = c.section(ConfigSection::shardDatabase());
     return setup;
 }
@@ -4,6 +4,8 @@
 #include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/nodestore/DatabaseRotating.h>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 namespace ripple {
@@ -17,6 +19,15 @@ private:
         std::string archiveDb;
         LedgerIndex lastRotated;
     };
+    struct CopyState
+    {
+        LedgerIndex seq = 0;
+        bool copying = false;
+        bool interrupted = false;
+        bool incremental = false;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::duration elapsed {};
+    };
     enum Health : std::uint8_t
     {
         ok = 0,
@@ -43,6 +54,7 @@ private:
     std::string const dbName_ = "state";
     std::string const dbPrefix_ = "rippledb";
     std::uint64_t const checkHealthInterval_ = 1000;
+    std::size_t const copyBatchSize_ = 256;
     static std::uint32_t const minimumDeletionInterval_ = 256;
     static std::uint32_t const minimumDeletionIntervalSA_ = 8;
     Setup setup_;
@@ -53,7 +65,7 @@ private:
     SavedStateDB state_db_;
     std::thread thread_;
     bool stop_ = false;
-    bool healthy_ = true;
+    std::atomic<bool> healthy_ {true};
     mutable std::condition_variable cond_;
     mutable std::condition_variable rendezvous_;
     mutable std::mutex mutex_;
@@ -61,6 +73,10 @@ private:
     std::atomic<bool> working_;
     TransactionMaster& transactionMaster_;
     std::atomic <LedgerIndex> canDelete_;
+    CopyState copyState_;
+    std::atomic<std::uint64_t> copiedNodes_ {0};
+    std::shared_ptr<SHAMap const> lastCopy_;
+    std::string lastCopyBackend_;
     NetworkOPs* netOPs_ = nullptr;
     LedgerMaster* ledgerMaster_ = nullptr;
     FullBelowCache* fullBelowCache_ = nullptr;
@@ -119,8 +135,14 @@ public:
     void onLedgerClosed (std::shared_ptr<Ledger const> const& ledger) override;
     void rendezvous() const override;
     int fdlimit() const override;
+    Json::Value copyProgress() const override;
 private:
-    bool copyNode (std::uint64_t& nodeCount, SHAMapAbstractNode const &node);
+    void copyState (
+        std::shared_ptr<SHAMap const> const& map, LedgerIndex seq);
+    bool copyBranches (SHAMap const& map, LedgerIndex seq);
+    bool copyDifferences (SHAMap const& map, LedgerIndex seq);
+    bool copyBatch (std::vector<uint256>& batch, LedgerIndex seq,
+        std::uint64_t& sinceCheck);
     void run();
     void dbPaths();
     std::unique_ptr<NodeStore::Backend>
@@ -0,0 +1,101 @@
+#ifndef RIPPLE_APP_MISC_SIGNATUREVERIFIER_H_INCLUDED
+#define RIPPLE_APP_MISC_SIGNATUREVERIFIER_H_INCLUDED
+#include <ripple/basics/base_uint.h>
+#include <ripple/basics/Blob.h>
+#include <ripple/basics/Buffer.h>
+#include <ripple/basics/LatencyHistogram.h>
+#include <ripple/basics/Slice.h>
+#include <ripple/core/Stoppable.h>
+#include <ripple/json/json_value.h>
+#include <ripple/protocol/PublicKey.h>
+#include <ripple/protocol/STTx.h>
+#include <boost/optional.hpp>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+namespace ripple {
+class SignatureVerifier : public Stoppable
+{
+public:
+    using Callback = std::function<void(bool)>;
+    static std::size_t constexpr batchSize = 64;
+    static std::size_t constexpr queueLimit = 4096;
+    static std::size_t constexpr untrustedLimit = 1024;
+    SignatureVerifier (Stoppable& parent, std::size_t threads);
+    ~SignatureVerifier () override;
+    bool
+    verify (PublicKey const& publicKey,
+        Blob message,
+        Slice const& signature,
+        bool mustBeFullyCanonical,
+        Callback callback);
+    bool
+    verifyDigest (PublicKey const& publicKey,
+        uint256 const& digest,
+        Slice const& signature,
+        bool mustBeFullyCanonical,
+        bool trusted,
+        Callback callback);
+    bool
+    verifyTransaction (std::shared_ptr<STTx const> const& tx,
+        bool allowMultiSign,
+        Callback callback);
+    std::size_t
+    pending () const;
+    void
+    getCountsJson (Json::Value& obj) const;
+private:
+    enum Priority
+    {
+        consensus,
+        ed25519,
+        secp256k1,
+        untrusted,
+        priorityCount
+    };
+    struct Request
+    {
+        PublicKey publicKey;
+        Blob message;
+        boost::optional<uint256> digest;
+        Buffer signature;
+        bool mustBeFullyCanonical;
+        std::shared_ptr<STTx const> tx;
+        bool allowMultiSign;
+        Callback callback;
+        std::chrono::steady_clock::time_point queued;
+    };
+    struct Queue
+    {
+        std::deque<Request> requests;
+        std::size_t limit {0};
+        std::uint64_t served {0};
+        std::uint64_t batches {0};
+        std::uint64_t dropped {0};
+        LatencyHistogram waits;
+    };
+    bool
+    submit (Priority priority, Request&& request);
+    void
+    onStop () override;
+    void
+    stopThreads ();
+    void
+    threadEntry ();
+    static
+    std::vector<bool>
+    check (std::vector<Request> const& batch);
+    std::mutex mutable mutex_;
+    std::condition_variable cond_;
+    std::array<Queue, priorityCount> queues_;
+    std::vector<std::thread> threads_;
+    bool shut_ {false};
+};
+}
+#endif
@@ -6,7 +6,7 @@
 #include <ripple/app/misc/impl/AccountTxPaging.h>
 #include <ripple/protocol/Serializer.h>
 #include <ripple/protocol/UintTypes.h>
-#include <boost/format.hpp>
+#include <limits>
 #include <memory>
 namespace ripple {
 void
@@ -52,122 +52,69 @@ accountTxPage (
     bool bAdmin,
     std::uint32_t page_length)
 {
-    bool lookingForMarker = token.isObject();
     std::uint32_t numberOfResults;
     if (limit <= 0 || (limit > page_length && !bAdmin))
         numberOfResults = page_length;
     else
         numberOfResults = limit;
-    std::uint32_t queryLimit = numberOfResults + 1;
-    std::uint32_t findLedger = 0, findSeq = 0;
-    if (lookingForMarker)
+    std::uint64_t firstLedger, lastLedger, findLedger, findSeq;
+    if (forward)
+    {
+        firstLedger = findLedger = minLedger;
+        lastLedger = maxLedger;
+        findSeq = 0;
+    }
+    else
+    {
+        firstLedger = minLedger;
+        lastLedger = findLedger = maxLedger;
+        findSeq = std::numeric_limits<std::uint32_t>::max ();
+    }
+    if (token.isObject())
     {
         try
         {
             if (!token.isMember(jss::ledger) || !token.isMember(jss::seq))
                 return;
-            findLedger = token[jss::ledger].asInt();
-            findSeq = token[jss::seq].asInt();
+            findLedger = token[jss::ledger].asUInt();
+            findSeq = token[jss::seq].asUInt();
         }
         catch (std::exception const&)
         {
             return;
         }
+        if (forward)
+            firstLedger = findLedger;
+        else
+            lastLedger = findLedger;
     }
     token = Json::nullValue;
-    static std::string const prefix (
+    static std::string const forwardSQL (
         R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
           Status,RawTxn,TxnMeta
           FROM AccountTransactions INNER JOIN Transactions
           ON Transactions.TransID = AccountTransactions.TransID
-          AND AccountTransactions.Account = '%s' WHERE
-          )");
-    std::string sql;
-    if (forward && (findLedger == 0))
-    {
-        sql = boost::str (boost::format(
-            prefix +
-            (R"(AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u'
-             ORDER BY AccountTransactions.LedgerSeq ASC,
-             AccountTransactions.TxnSeq ASC
-             LIMIT %u;)"))
-            % idCache.toBase58(account)
-            % minLedger
-            % maxLedger
-            % queryLimit);
-    }
-    else if (forward && (findLedger != 0))
-    {
-        auto b58acct = idCache.toBase58(account);
-        sql = boost::str (boost::format(
-            (R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-            Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u')
-            OR
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq = '%u' AND
-            AccountTransactions.TxnSeq >= '%u')
-            ORDER BY AccountTransactions.LedgerSeq ASC,
-            AccountTransactions.TxnSeq ASC
-            LIMIT %u;
-            )"))
-        % b58acct
-        % (findLedger + 1)
-        % maxLedger
-        % b58acct
-        % findLedger
-        % findSeq
-        % queryLimit);
-    }
-    else if (!forward && (findLedger == 0))
-    {
-        sql = boost::str (boost::format(
-            prefix +
-            (R"(AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u'
-             ORDER BY AccountTransactions.LedgerSeq DESC,
-             AccountTransactions.TxnSeq DESC
-             LIMIT %u;)"))
-            % idCache.toBase58(account)
-            % minLedger
-            % maxLedger
-            % queryLimit);
-    }
-    else if (!forward && (findLedger != 0))
-    {
-        auto b58acct = idCache.toBase58(account);
-        sql = boost::str (boost::format(
-            (R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-            Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u')
-            OR
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq = '%u' AND
-            AccountTransactions.TxnSeq <= '%u')
-            ORDER BY AccountTransactions.LedgerSeq DESC,
-            AccountTransactions.TxnSeq DESC
-            LIMIT %u;
-            )"))
-            % b58acct
-            % minLedger
-            % (findLedger - 1)
-            % b58acct
-            % findLedger
-            % findSeq
-            % queryLimit);
-    }
-    else
-    {
-        assert (false);
-        return;
-    }
+          WHERE AccountTransactions.Account = :account AND
+          AccountTransactions.LedgerSeq BETWEEN :first AND :last AND
+          (AccountTransactions.LedgerSeq > :ledger OR
+           AccountTransactions.TxnSeq >= :seq)
+          ORDER BY AccountTransactions.LedgerSeq ASC,
+          AccountTransactions.TxnSeq ASC
+          LIMIT :limit;)");
+    static std::string const backwardSQL (
+        R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
+          Status,RawTxn,TxnMeta
+          FROM AccountTransactions INNER JOIN Transactions
+          ON Transactions.TransID = AccountTransactions.TransID
+          WHERE AccountTransactions.Account = :account AND
+          AccountTransactions.LedgerSeq BETWEEN :first AND :last AND
+          (AccountTransactions.LedgerSeq < :ledger OR
+           AccountTransactions.TxnSeq <= :seq)
+          ORDER BY AccountTransactions.LedgerSeq DESC,
+          AccountTransactions.TxnSeq DESC
+          LIMIT :limit;)");
+    auto const b58acct = idCache.toBase58(account);
+    std::uint64_t const queryLimit = numberOfResults + 1;
     {
         auto db (connection.checkoutDb());
         Blob rawData;
@@ -178,7 +125,13 @@ accountTxPage (
         soci::blob txnData (*db);
         soci::blob txnMeta (*db);
         soci::indicator dataPresent, metaPresent;
-        soci::statement st = (db->prepare << sql,
+        soci::statement st = (db->prepare << (forward ? forwardSQL : backwardSQL),
+            soci::use (b58acct, "account"),
+            soci::use (firstLedger, "first"),
+            soci::use (lastLedger, "last"),
+            soci::use (findLedger, "ledger"),
+            soci::use (findSeq, "seq"),
+            soci::use (queryLimit, "limit"),
             soci::into (ledgerSeq),
             soci::into (txnSeq),
             soci::into (status),
@@ -187,37 +140,26 @@ accountTxPage (
         st.execute ();
         while (st.fetch ())
         {
-            if (lookingForMarker)
-            {
-                if (findLedger == ledgerSeq.value_or (0) &&
-                    findSeq == txnSeq.value_or (0))
-                {
-                    lookingForMarker = false;
-                }
-            }
-            else if (numberOfResults == 0)
+            if (numberOfResults == 0)
             {
                 token = Json::objectValue;
                 token[jss::ledger] = rangeCheckedCast<std::uint32_t>(ledgerSeq.value_or (0));
                 token[jss::seq] = txnSeq.value_or (0);
                 break;
             }
-            if (!lookingForMarker)
-            {
-                if (dataPresent == soci::i_ok)
-                    convert (txnData, rawData);
-                else
-                    rawData.clear ();
-                if (metaPresent == soci::i_ok)
-                    convert (txnMeta, rawMeta);
-                else
-                    rawMeta.clear ();
-                if (rawMeta.size() == 0)
-                    onUnsavedLedger(ledgerSeq.value_or (0));
-                onTransaction(rangeCheckedCast<std::uint32_t>(ledgerSeq.value_or (0)),
-                    *status, rawData, rawMeta);
-                --numberOfResults;
-            }
+            if (dataPresent == soci::i_ok)
+                convert (txnData, rawData);
+            else
+                rawData.clear ();
+            if (metaPresent == soci::i_ok)
+                convert (txnMeta, rawMeta);
+            else
+                rawMeta.clear ();
+            if (rawMeta.size() == 0)
+                onUnsavedLedger(ledgerSeq.value_or (0));
+            onTransaction(rangeCheckedCast<std::uint32_t>(ledgerSeq.value_or (0)),
+                *status, rawData, rawMeta);
+            --numberOfResults;
         }
     }
     return;
@@ -0,0 +1,215 @@
+#include <ripple/app/misc/SignatureVerifier.h>
+#include <ripple/beast/core/CurrentThreadName.h>
+#include <ripple/protocol/jss.h>
+#include <ripple/protocol/TxFlags.h>
+#include <algorithm>
+#include <iterator>
+namespace ripple {
+static
+std::array<char const*, 4> const queueNames {{
+    "consensus", "ed25519", "secp256k1", "untrusted"}};
+SignatureVerifier::SignatureVerifier (Stoppable& parent, std::size_t threads)
+    : Stoppable ("SignatureVerifier", parent)
+{
+    queues_[consensus].limit = queueLimit;
+    queues_[ed25519].limit = queueLimit;
+    queues_[secp256k1].limit = queueLimit;
+    queues_[untrusted].limit = untrustedLimit;
+    threads = std::max<std::size_t> (threads, 1);
+    while (threads-- > 0)
+        threads_.emplace_back (&SignatureVerifier::threadEntry, this);
+}
+SignatureVerifier::~SignatureVerifier ()
+{
+    stopThreads ();
+}
+bool
+SignatureVerifier::verify (PublicKey const& publicKey,
+    Blob message,
+    Slice const& signature,
+    bool mustBeFullyCanonical,
+    Callback callback)
+{
+    auto const type = publicKeyType (publicKey);
+    if (! type)
+    {
+        callback (false);
+        return true;
+    }
+    return submit (*type == KeyType::ed25519 ? ed25519 : secp256k1,
+        {publicKey, std::move (message), boost::none,
+            Buffer (signature.data(), signature.size()),
+                mustBeFullyCanonical, nullptr, false, std::move (callback),
+                    {}});
+}
+bool
+SignatureVerifier::verifyDigest (PublicKey const& publicKey,
+    uint256 const& digest,
+    Slice const& signature,
+    bool mustBeFullyCanonical,
+    bool trusted,
+    Callback callback)
+{
+    if (publicKeyType (publicKey) != KeyType::secp256k1)
+    {
+        callback (false);
+        return true;
+    }
+    return submit (trusted ? consensus : untrusted,
+        {publicKey, {}, digest,
+            Buffer (signature.data(), signature.size()),
+                mustBeFullyCanonical, nullptr, false, std::move (callback),
+                    {}});
+}
+bool
+SignatureVerifier::verifyTransaction (
+    std::shared_ptr<STTx const> const& tx,
+    bool allowMultiSign,
+    Callback callback)
+{
+    auto const spk = tx->getSigningPubKey ();
+    if (tx->isFieldPresent (sfSigners) || ! publicKeyType (makeSlice (spk)))
+    {
+        return submit (secp256k1,
+            {{}, {}, boost::none, {}, false, tx, allowMultiSign,
+                std::move (callback), {}});
+    }
+    return verify (PublicKey (makeSlice (spk)),
+        tx->getSigningData (),
+        makeSlice (tx->getSignature ()),
+        tx->getFlags () & tfFullyCanonicalSig,
+        std::move (callback));
+}
+std::size_t
+SignatureVerifier::pending () const
+{
+    std::lock_guard<std::mutex> lock (mutex_);
+    std::size_t n = 0;
+    for (auto const& queue : queues_)
+        n += queue.requests.size();
+    return n;
+}
+void
+SignatureVerifier::getCountsJson (Json::Value& obj) const
+{
+    Json::Value& jv = (obj[jss::sig_verify] = Json::objectValue);
+    std::lock_guard<std::mutex> lock (mutex_);
+    jv[jss::threads] = static_cast<Json::UInt>(threads_.size());
+    for (std::size_t i = 0; i < priorityCount; ++i)
+    {
+        auto const& queue = queues_[i];
+        Json::Value& jq = (jv[queueNames[i]] = Json::objectValue);
+        jq[jss::depth] = static_cast<Json::UInt>(queue.requests.size());
+        if (queue.limit)
+            jq[jss::limit] = static_cast<Json::UInt>(queue.limit);
+        jq[jss::served] = std::to_string (queue.served);
+        jq[jss::batches] = std::to_string (queue.batches);
+        jq[jss::dropped] = std::to_string (queue.dropped);
+        jq[jss::p50_us] = std::to_string (
+            queue.waits.percentile (0.5).count());
+        jq[jss::p99_us] = std::to_string (
+            queue.waits.percentile (0.99).count());
+        jq[jss::max_us] = std::to_string (queue.waits.max().count());
+    }
+}
+bool
+SignatureVerifier::submit (Priority priority, Request&& request)
+{
+    request.queued = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock (mutex_);
+    auto& queue = queues_[priority];
+    if (shut_ || (queue.limit && queue.requests.size() >= queue.limit))
+    {
+        ++queue.dropped;
+        return false;
+    }
+    queue.requests.push_back (std::move (request));
+    cond_.notify_one();
+    return true;
+}
+void
+SignatureVerifier::onStop ()
+{
+    stopThreads ();
+    stopped ();
+}
+void
+SignatureVerifier::stopThreads ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        if (shut_)
+            return;
+        shut_ = true;
+        cond_.notify_all();
+    }
+    for (auto& t : threads_)
+        t.join();
+}
+void
+SignatureVerifier::threadEntry ()
+{
+    beast::setCurrentThreadName ("sigverify");
+    while (true)
+    {
+        std::vector<Request> batch;
+        {
+            std::unique_lock<std::mutex> lock (mutex_);
+            auto next = [this]()
+            {
+                for (auto& queue : queues_)
+                    if (! queue.requests.empty())
+                        return &queue;
+                return static_cast<Queue*>(nullptr);
+            };
+            Queue* queue;
+            while (! shut_ && ! (queue = next()))
+                cond_.wait (lock);
+            if (shut_)
+                break;
+            auto const n = std::min (batchSize, queue->requests.size());
+            batch.reserve (n);
+            std::move (queue->requests.begin(), queue->requests.begin() + n,
+                std::back_inserter (batch));
+            queue->requests.erase (
+                queue->requests.begin(), queue->requests.begin() + n);
+            auto const now = std::chrono::steady_clock::now();
+            for (auto const& r : batch)
+                queue->waits.insert (std::chrono::duration_cast<
+                    std::chrono::microseconds>(now - r.queued));
+            queue->served += n;
+            ++queue->batches;
+        }
+        auto const valid = check (batch);
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            batch[i].callback (valid[i]);
+    }
+}
+std::vector<bool>
+SignatureVerifier::check (std::vector<Request> const& batch)
+{
+    std::vector<SignedMessage> messages;
+    messages.reserve (batch.size());
+    for (auto const& r : batch)
+    {
+        if (! r.digest && ! r.tx)
+            messages.push_back ({r.publicKey, makeSlice (r.message),
+                r.signature, r.mustBeFullyCanonical});
+    }
+    auto const valid = verifyBatch (messages);
+    std::vector<bool> result;
+    result.reserve (batch.size());
+    std::size_t i = 0;
+    for (auto const& r : batch)
+    {
+        if (r.tx)
+            result.push_back (r.tx->checkSign (r.allowMultiSign).first);
+        else if (r.digest)
+            result.push_back (ripple::verifyDigest (r.publicKey,
+                *r.digest, r.signature, r.mustBeFullyCanonical));
+        else
+            result.push_back (valid[i++]);
+    }
+    return result;
+}
+}
@@ -24,7 +24,11 @@ PathRequests::getLineCache (
          (authoritative && ((lgrSeq + 8)  < lineSeq)) ||   
          (lgrSeq > (lineSeq + 8)))                         
     {
-        mLineCache = std::make_shared<RippleLineCache> (ledger);
+        if (mLineCache && mLineCache->isParentOf (*ledger))
+            mLineCache = std::make_shared<RippleLineCache> (
+                ledger, *mLineCache, mJournal);
+        else
+            mLineCache = std::make_shared<RippleLineCache> (ledger);
     }
     return mLineCache;
 }
@@ -10,6 +10,10 @@
 #include <ripple/json/to_string.h>
 #include <ripple/core/JobQueue.h>
 #include <ripple/core/Config.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <tuple>
 
 namespace ripple {
@@ -273,6 +277,43 @@ STAmount smallestUsefulAmount (STAmount const& amount, int maxPaths)
 {
     return divide (amount, STAmount (maxPaths + 2), amount.issue ());
 }
+template <class Work>
+void parallelFor (
+    JobQueue& jobQueue, std::size_t count, int helpers, Work const& work)
+{
+    struct State
+    {
+        std::function<void (std::size_t)> work;
+        std::size_t count;
+        std::atomic<std::size_t> next {0};
+        std::size_t done = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        void run ()
+        {
+            for (auto i = next++; i < count; i = next++)
+            {
+                work (i);
+                std::lock_guard<std::mutex> lock (mutex);
+                if (++done == count)
+                    cv.notify_all ();
+            }
+        }
+    };
+    if (count == 0)
+        return;
+    auto state = std::make_shared<State> ();
+    state->work = work;
+    state->count = count;
+    for (std::size_t i = 1; i < count && helpers-- > 0; ++i)
+    {
+        jobQueue.addJob (jtPATH_RANK, "Pathfinder::rankPaths",
+            [state] (Job&) { state->run (); });
+    }
+    state->run ();
+    std::unique_lock<std::mutex> lock (state->mutex);
+    state->cv.wait (lock, [&state] { return state->done == state->count; });
+}
 } 
 void Pathfinder::computePathRanks (int maxPaths)
 {
@@ -340,15 +381,26 @@ void Pathfinder::rankPaths (
     {
         saMinDstAmount = smallestUsefulAmount(mDstAmount, maxPaths);
     }
+    struct Liquidity
+    {
+        TER result = tefEXCEPTION;
+        STAmount amount;
+        uint64_t quality = 0;
+    };
+    std::vector<Liquidity> liquidity (paths.size ());
+    parallelFor (app_.getJobQueue (), paths.size (), PATHFINDER_RANK_HELPERS,
+        [&](std::size_t i)
+        {
+            if (! paths[i].empty())
+                liquidity[i].result = getPathLiquidity (paths[i],
+                    saMinDstAmount, liquidity[i].amount, liquidity[i].quality);
+        });
     for (int i = 0; i < paths.size (); ++i)
     {
         auto const& currentPath = paths[i];
         if (! currentPath.empty())
         {
-            STAmount liquidity;
-            uint64_t uQuality;
-            auto const resultCode = getPathLiquidity (
-                currentPath, saMinDstAmount, liquidity, uQuality);
+            auto const resultCode = liquidity[i].result;
             if (resultCode != tesSUCCESS)
             {
                 JLOG (j_.debug()) <<
@@ -359,10 +411,10 @@ void Pathfinder::rankPaths (
             else
             {
                 JLOG (j_.debug()) <<
-                    "findPaths: quality: " << uQuality <<
+                    "findPaths: quality: " << liquidity[i].quality <<
                     ": " << currentPath.getJson (JsonOptions::none);
-                rankedPaths.push_back ({uQuality,
-                    currentPath.size (), liquidity, i});
+                rankedPaths.push_back ({liquidity[i].quality,
+                    currentPath.size (), liquidity[i].amount, i});
             }
         }
     }
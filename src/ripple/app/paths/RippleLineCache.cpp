@@ -1,12 +1,45 @@
 
 #include <ripple/app/paths/RippleLineCache.h>
 #include <ripple/ledger/OpenView.h>
+#include <ripple/ledger/TxMeta.h>
 namespace ripple {
 RippleLineCache::RippleLineCache(
     std::shared_ptr <ReadView const> const& ledger)
 {
     mLedger = std::make_shared<OpenView>(&*ledger, ledger);
 }
+RippleLineCache::RippleLineCache(
+    std::shared_ptr <ReadView const> const& ledger,
+    RippleLineCache& previous,
+    beast::Journal j)
+    : hasher_ (previous.hasher_)
+{
+    mLedger = std::make_shared<OpenView>(&*ledger, ledger);
+    hash_set<AccountID> affected;
+    for (auto const& item : ledger->txs)
+    {
+        if (! item.second)
+            continue;
+        TxMeta const meta (item.first->getTransactionID(),
+            ledger->info().seq, *item.second);
+        for (auto const& account : meta.getAffectedAccounts (j))
+            affected.insert (account);
+    }
+    std::lock_guard <std::mutex> sl (previous.mLock);
+    lines_.reserve (previous.lines_.size());
+    for (auto const& entry : previous.lines_)
+    {
+        if (affected.count (entry.first.account_) == 0)
+            lines_.emplace (entry);
+    }
+}
+bool
+RippleLineCache::isParentOf (ReadView const& ledger) const
+{
+    return ! ledger.open() &&
+        ledger.info().seq == mLedger->info().seq + 1 &&
+        ledger.info().parentHash == mLedger->info().hash;
+}
 std::vector<RippleState::pointer> const&
 RippleLineCache::getRippleLines (AccountID const& accountID)
 {
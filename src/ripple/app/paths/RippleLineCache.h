@@ -3,6 +3,7 @@
 #include <ripple/app/ledger/Ledger.h>
 #include <ripple/app/paths/RippleState.h>
 #include <ripple/basics/hardened_hash.h>
+#include <ripple/beast/utility/Journal.h>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -14,6 +15,12 @@ public:
     explicit
     RippleLineCache (
         std::shared_ptr <ReadView const> const& l);
+    RippleLineCache (
+        std::shared_ptr <ReadView const> const& l,
+        RippleLineCache& previous,
+        beast::Journal j);
+    bool
+    isParentOf (ReadView const& l) const;
     std::shared_ptr <ReadView const> const&
     getLedger () const
     {
@@ -9,5 +9,6 @@ int const PATHFINDER_HIGH_PRIORITY = 100000;
 int const PATHFINDER_MAX_PATHS = 50;
 int const PATHFINDER_MAX_COMPLETE_PATHS = 1000;
 int const PATHFINDER_MAX_PATHS_FROM_SOURCE = 10;
+int const PATHFINDER_RANK_HELPERS = 3;
 } 
 #endif
@@ -1,10 +1,50 @@
 #ifndef RIPPLE_BASICS_ARCHIVE_H_INCLUDED
 #define RIPPLE_BASICS_ARCHIVE_H_INCLUDED
 #include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 namespace ripple {
 void
 extractTarLz4(
     boost::filesystem::path const& src,
     boost::filesystem::path const& dst);
+class TarLz4Stream
+{
+public:
+    TarLz4Stream(
+        boost::filesystem::path const& dst,
+        std::size_t maxPending = 64);
+    TarLz4Stream(TarLz4Stream const&) = delete;
+    TarLz4Stream& operator= (TarLz4Stream const&) = delete;
+    ~TarLz4Stream();
+    void
+    write(void const* data, std::size_t size);
+    void
+    finish();
+    void
+    abort();
+private:
+    boost::filesystem::path const dst_;
+    std::size_t const maxPending_;
+    std::mutex m_;
+    std::condition_variable cv_;
+    std::deque<std::vector<std::uint8_t>> pending_;
+    std::vector<std::uint8_t> current_;
+    bool closed_ {false};
+    bool aborted_ {false};
+    bool done_ {false};
+    std::string error_;
+    std::once_flag joined_;
+    std::thread thread_;
+    void
+    run();
+    bool
+    next(void const** buffer, std::size_t& size);
+};
 } 
 #endif
@@ -0,0 +1,91 @@
+#ifndef RIPPLE_BASICS_LATENCYHISTOGRAM_H_INCLUDED
+#define RIPPLE_BASICS_LATENCYHISTOGRAM_H_INCLUDED
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+namespace ripple {
+class LatencyHistogram
+{
+public:
+    using microseconds = std::chrono::microseconds;
+    static int constexpr subBucketBits = 4;
+    static int constexpr subBuckets = 1 << subBucketBits;
+    static int constexpr magnitudes = 40;
+    static std::size_t constexpr buckets =
+        (magnitudes - subBucketBits + 1) * subBuckets;
+    void insert (microseconds d)
+    {
+        auto const v = static_cast<std::uint64_t> (
+            std::max<microseconds::rep> (d.count (), 0));
+        ++counts_[bucket (v)];
+        ++count_;
+        max_ = std::max (max_, v);
+    }
+    void merge (LatencyHistogram const& other)
+    {
+        for (std::size_t i = 0; i < buckets; ++i)
+            counts_[i] += other.counts_[i];
+        count_ += other.count_;
+        max_ = std::max (max_, other.max_);
+    }
+    void clear ()
+    {
+        counts_.fill (0);
+        count_ = 0;
+        max_ = 0;
+    }
+    std::uint64_t count () const
+    {
+        return count_;
+    }
+    microseconds max () const
+    {
+        return microseconds (max_);
+    }
+    microseconds percentile (double p) const
+    {
+        if (count_ == 0)
+            return microseconds (0);
+        auto const target = std::max<std::uint64_t> (1,
+            static_cast<std::uint64_t> (std::ceil (p * count_)));
+        std::uint64_t seen = 0;
+        std::size_t i = 0;
+        for (; i < buckets - 1; ++i)
+        {
+            seen += counts_[i];
+            if (seen >= target)
+                break;
+        }
+        if (i == buckets - 1)
+            return microseconds (max_);
+        return microseconds (std::min (upperBound (i), max_));
+    }
+private:
+    static std::size_t bucket (std::uint64_t v)
+    {
+        if (v < subBuckets)
+            return static_cast<std::size_t> (v);
+        v = std::min<std::uint64_t> (v, (std::uint64_t (1) << magnitudes) - 1);
+        int m = subBucketBits;
+        while ((v >> (m + 1)) != 0)
+            ++m;
+        auto const shift = m - subBucketBits;
+        return ((m - subBucketBits + 1) << subBucketBits) +
+            static_cast<std::size_t> ((v >> shift) - subBuckets);
+    }
+    static std::uint64_t upperBound (std::size_t i)
+    {
+        if (i < subBuckets)
+            return i;
+        auto const shift = (i >> subBucketBits) - 1;
+        auto const lower = (subBuckets + (i & (subBuckets - 1))) << shift;
+        return lower + (std::uint64_t (1) << shift) - 1;
+    }
+    std::array<std::uint64_t, buckets> counts_ {};
+    std::uint64_t count_ = 0;
+    std::uint64_t max_ = 0;
+};
+}
+#endif
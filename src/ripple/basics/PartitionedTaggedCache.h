@@ -0,0 +1,215 @@
+#ifndef RIPPLE_BASICS_PARTITIONEDTAGGEDCACHE_H_INCLUDED
+#define RIPPLE_BASICS_PARTITIONEDTAGGEDCACHE_H_INCLUDED
+#include <ripple/basics/TaggedCache.h>
+#include <boost/optional.hpp>
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+namespace ripple {
+template <
+    class Key,
+    class T,
+    class Hash = hardened_hash <>,
+    class KeyEqual = std::equal_to <Key>,
+    class Mutex = std::recursive_mutex
+>
+class PartitionedTaggedCache
+{
+public:
+    using partition_type = TaggedCache <Key, T, Hash, KeyEqual, Mutex>;
+    using key_type = Key;
+    using mapped_type = T;
+    using weak_mapped_ptr = std::weak_ptr <mapped_type>;
+    using mapped_ptr = std::shared_ptr <mapped_type>;
+    using clock_type = beast::abstract_clock <std::chrono::steady_clock>;
+    static std::size_t constexpr defaultPartitions = 16;
+public:
+    PartitionedTaggedCache (std::string const& name, int size,
+        clock_type::duration expiration, clock_type& clock, beast::Journal journal,
+            beast::insight::Collector::ptr const& collector = beast::insight::NullCollector::New (),
+                std::size_t partitions = defaultPartitions)
+        : m_clock (clock)
+        , m_stats (name,
+            std::bind (&PartitionedTaggedCache::collect_metrics, this),
+                collector)
+    {
+        assert (partitions > 0);
+        m_partitions.reserve (partitions);
+        for (std::size_t i = 0; i < partitions; ++i)
+            m_partitions.push_back (std::make_unique <partition_type> (
+                name, partitionSize (size, partitions), expiration,
+                    clock, journal));
+    }
+public:
+    clock_type& clock ()
+    {
+        return m_clock;
+    }
+    std::size_t partitions () const
+    {
+        return m_partitions.size ();
+    }
+    int getTargetSize () const
+    {
+        int size = 0;
+        for (auto const& p : m_partitions)
+            size += p->getTargetSize ();
+        return size;
+    }
+    void setTargetSize (int s)
+    {
+        for (auto& p : m_partitions)
+            p->setTargetSize (partitionSize (s, m_partitions.size ()));
+    }
+    clock_type::duration getTargetAge () const
+    {
+        return m_partitions.front ()->getTargetAge ();
+    }
+    void setTargetAge (clock_type::duration s)
+    {
+        for (auto& p : m_partitions)
+            p->setTargetAge (s);
+    }
+    int getCacheSize () const
+    {
+        int size = 0;
+        for (auto const& p : m_partitions)
+            size += p->getCacheSize ();
+        return size;
+    }
+    int getTrackSize () const
+    {
+        int size = 0;
+        for (auto const& p : m_partitions)
+            size += p->getTrackSize ();
+        return size;
+    }
+    float getHitRate ()
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        for (auto& p : m_partitions)
+        {
+            auto const counts = p->getHitCounts ();
+            hits += counts.first;
+            misses += counts.second;
+        }
+        auto const total = static_cast<float> (hits + misses);
+        return hits * (100.0f / std::max (1.0f, total));
+    }
+    void clear ()
+    {
+        for (auto& p : m_partitions)
+            p->clear ();
+    }
+    void reset ()
+    {
+        for (auto& p : m_partitions)
+            p->reset ();
+    }
+    void sweep ()
+    {
+        auto const size = m_partitions.size ();
+        std::size_t first;
+        std::size_t count = size;
+        {
+            std::lock_guard <std::mutex> lock (m_sweepMutex);
+            auto const now = m_clock.now ();
+            auto const age = getTargetAge ();
+            if (m_lastSweep && now - *m_lastSweep < age)
+            {
+                auto const interval = static_cast<std::size_t> (
+                    (now - *m_lastSweep).count ());
+                auto const period = static_cast<std::size_t> (age.count ());
+                count = std::max <std::size_t> (1,
+                    (size * interval + period - 1) / period);
+            }
+            m_lastSweep = now;
+            first = m_nextSweep;
+            m_nextSweep = (first + count) % size;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_partitions[(first + i) % size]->sweep ();
+            std::this_thread::yield ();
+        }
+    }
+    bool del (const key_type& key, bool valid)
+    {
+        return partition (key).del (key, valid);
+    }
+    bool canonicalize (const key_type& key, std::shared_ptr<T>& data, bool replace = false)
+    {
+        return partition (key).canonicalize (key, data, replace);
+    }
+    std::shared_ptr<T> fetch (const key_type& key)
+    {
+        return partition (key).fetch (key);
+    }
+    bool insert (key_type const& key, T const& value)
+    {
+        return partition (key).insert (key, value);
+    }
+    bool retrieve (const key_type& key, T& data)
+    {
+        return partition (key).retrieve (key, data);
+    }
+    bool refreshIfPresent (const key_type& key)
+    {
+        return partition (key).refreshIfPresent (key);
+    }
+    std::vector <key_type> getKeys () const
+    {
+        std::vector <key_type> v;
+        for (auto const& p : m_partitions)
+        {
+            auto keys = p->getKeys ();
+            v.insert (v.end (), keys.begin (), keys.end ());
+        }
+        return v;
+    }
+private:
+    static int partitionSize (int size, std::size_t partitions)
+    {
+        if (size <= 0)
+            return size;
+        return std::max (1, static_cast<int> (
+            (size + partitions - 1) / partitions));
+    }
+    partition_type& partition (key_type const& key)
+    {
+        return *m_partitions[m_hash (key) % m_partitions.size ()];
+    }
+    void collect_metrics ()
+    {
+        m_stats.size.set (getCacheSize ());
+        m_stats.hit_rate.set (
+            static_cast<beast::insight::Gauge::value_type> (getHitRate ()));
+    }
+private:
+    struct Stats
+    {
+        template <class Handler>
+        Stats (std::string const& prefix, Handler const& handler,
+            beast::insight::Collector::ptr const& collector)
+            : hook (collector->make_hook (handler))
+            , size (collector->make_gauge (prefix, "size"))
+            , hit_rate (collector->make_gauge (prefix, "hit_rate"))
+            { }
+        beast::insight::Hook hook;
+        beast::insight::Gauge size;
+        beast::insight::Gauge hit_rate;
+    };
+    clock_type& m_clock;
+    Stats m_stats;
+    Hash m_hash;
+    std::vector <std::unique_ptr <partition_type>> m_partitions;
+    std::mutex m_sweepMutex;
+    boost::optional <clock_type::time_point> m_lastSweep;
+    std::size_t m_nextSweep = 0;
+};
+}
+#endif
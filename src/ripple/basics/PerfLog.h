@@ -42,6 +42,7 @@ public:
         microseconds dur, int instance) = 0;
     virtual Json::Value countersJson() const = 0;
     virtual Json::Value currentJson() const = 0;
+    virtual Json::Value histogramsJson() const = 0;
     virtual void resizeJobs(int const resize) = 0;
     virtual void rotate() = 0;
 };
@@ -7,6 +7,7 @@
 #include <ripple/beast/insight/Insight.h>
 #include <functional>
 #include <mutex>
+#include <utility>
 #include <vector>
 namespace ripple {
 struct TaggedCacheLog;
@@ -92,6 +93,11 @@ public:
         auto const total = static_cast<float> (m_hits + m_misses);
         return m_hits * (100.0f / std::max (1.0f, total));
     }
+    std::pair <std::uint64_t, std::uint64_t> getHitCounts ()
+    {
+        lock_guard lock (m_mutex);
+        return {m_hits, m_misses};
+    }
     void clear ()
     {
         lock_guard lock (m_mutex);
@@ -3,16 +3,14 @@
 #include <ripple/basics/contract.h>
 #include <archive.h>
 #include <archive_entry.h>
+#include <cerrno>
 namespace ripple {
-void
-extractTarLz4(
-    boost::filesystem::path const& src,
-    boost::filesystem::path const& dst)
+namespace {
+using archive_ptr =
+    std::unique_ptr<struct archive, void(*)(struct archive*)>;
+archive_ptr
+makeReader()
 {
-    if (!is_regular_file(src))
-        Throw<std::runtime_error>("Invalid source file");
-    using archive_ptr =
-        std::unique_ptr<struct archive, void(*)(struct archive*)>;
     archive_ptr ar {archive_read_new(),
         [](struct archive* ar)
         {
@@ -24,11 +22,11 @@ extractTarLz4(
         Throw<std::runtime_error>(archive_error_string(ar.get()));
     if (archive_read_support_filter_lz4(ar.get()) < ARCHIVE_OK)
         Throw<std::runtime_error>(archive_error_string(ar.get()));
-    if (archive_read_open_filename(
-        ar.get(), src.string().c_str(), 10240) < ARCHIVE_OK)
-    {
-        Throw<std::runtime_error>(archive_error_string(ar.get()));
-    }
+    return ar;
+}
+void
+extract(struct archive* ar, boost::filesystem::path const& dst)
+{
     archive_ptr aw {archive_write_disk_new(),
         [](struct archive* aw)
         {
@@ -49,11 +47,11 @@ extractTarLz4(
     struct archive_entry* entry;
     while(true)
     {
-        result = archive_read_next_header(ar.get(), &entry);
+        result = archive_read_next_header(ar, &entry);
         if (result == ARCHIVE_EOF)
             break;
         if (result < ARCHIVE_OK)
-            Throw<std::runtime_error>(archive_error_string(ar.get()));
+            Throw<std::runtime_error>(archive_error_string(ar));
         archive_entry_set_pathname(
             entry, (dst / archive_entry_pathname(entry)).string().c_str());
         if (archive_write_header(aw.get(), entry) < ARCHIVE_OK)
@@ -65,11 +63,11 @@ extractTarLz4(
             la_int64_t offset;
             while (true)
             {
-                result = archive_read_data_block(ar.get(), &buf, &sz, &offset);
+                result = archive_read_data_block(ar, &buf, &sz, &offset);
                 if (result == ARCHIVE_EOF)
                     break;
                 if (result < ARCHIVE_OK)
-                    Throw<std::runtime_error>(archive_error_string(ar.get()));
+                    Throw<std::runtime_error>(archive_error_string(ar));
                 if (archive_write_data_block(
                     aw.get(), buf, sz, offset) < ARCHIVE_OK)
                 {
@@ -82,3 +80,136 @@ extractTarLz4(
     }
 }
 } 
+void
+extractTarLz4(
+    boost::filesystem::path const& src,
+    boost::filesystem::path const& dst)
+{
+    if (!is_regular_file(src))
+        Throw<std::runtime_error>("Invalid source file");
+    auto ar {makeReader()};
+    if (archive_read_open_filename(
+        ar.get(), src.string().c_str(), 10240) < ARCHIVE_OK)
+    {
+        Throw<std::runtime_error>(archive_error_string(ar.get()));
+    }
+    extract(ar.get(), dst);
+}
+TarLz4Stream::TarLz4Stream(
+    boost::filesystem::path const& dst,
+    std::size_t maxPending)
+    : dst_(dst)
+    , maxPending_(std::max<std::size_t>(maxPending, 1))
+    , thread_(&TarLz4Stream::run, this)
+{
+}
+TarLz4Stream::~TarLz4Stream()
+{
+    abort();
+}
+void
+TarLz4Stream::write(void const* data, std::size_t size)
+{
+    std::unique_lock<std::mutex> lock(m_);
+    cv_.wait(lock, [this]
+    {
+        return pending_.size() < maxPending_ || done_ || aborted_;
+    });
+    if (aborted_)
+        return;
+    if (done_)
+    {
+        if (!error_.empty())
+            Throw<std::runtime_error>(error_);
+        return;
+    }
+    auto const p {static_cast<std::uint8_t const*>(data)};
+    pending_.emplace_back(p, p + size);
+    lock.unlock();
+    cv_.notify_all();
+}
+void
+TarLz4Stream::finish()
+{
+    std::unique_lock<std::mutex> lock(m_);
+    closed_ = true;
+    cv_.notify_all();
+    cv_.wait(lock, [this]
+    {
+        return done_;
+    });
+    if (!error_.empty())
+        Throw<std::runtime_error>(error_);
+}
+void
+TarLz4Stream::abort()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        aborted_ = true;
+    }
+    cv_.notify_all();
+    std::call_once(joined_, [this]
+    {
+        thread_.join();
+    });
+}
+void
+TarLz4Stream::run()
+{
+    std::string error;
+    try
+    {
+        auto ar {makeReader()};
+        auto const read = [](struct archive* ar,
+            void* client, void const** buffer) -> la_ssize_t
+        {
+            std::size_t size;
+            if (!static_cast<TarLz4Stream*>(client)->next(buffer, size))
+            {
+                archive_set_error(ar, ECANCELED, "Archive stream aborted");
+                return ARCHIVE_FATAL;
+            }
+            return static_cast<la_ssize_t>(size);
+        };
+        if (archive_read_open(
+            ar.get(), this, nullptr, read, nullptr) < ARCHIVE_OK)
+        {
+            Throw<std::runtime_error>(archive_error_string(ar.get()));
+        }
+        extract(ar.get(), dst_);
+    }
+    catch (std::exception const& e)
+    {
+        error = e.what();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        error_ = std::move(error);
+        done_ = true;
+        pending_.clear();
+    }
+    cv_.notify_all();
+}
+bool
+TarLz4Stream::next(void const** buffer, std::size_t& size)
+{
+    std::unique_lock<std::mutex> lock(m_);
+    cv_.wait(lock, [this]
+    {
+        return !pending_.empty() || closed_ || aborted_;
+    });
+    if (aborted_)
+        return false;
+    size = 0;
+    if (pending_.empty())
+        return true;
+    current_ = std::move(pending_.front());
+    pending_.pop_front();
+    lock.unlock();
+    cv_.notify_all();
+    *buffer = current_.data();
+    size = current_.size();
+    return true;
+}
+} 
@@ -186,6 +186,67 @@ PerfLogImp::Counters::currentJson() const
     current[jss::methods] = methodsArray;
     return current;
 }
+static
+Json::Value
+latencyJson(LatencyHistogram const& h)
+{
+    Json::Value ret(Json::objectValue);
+    ret[jss::count] = std::to_string(h.count());
+    ret[jss::p50_us] = std::to_string(h.percentile(0.5).count());
+    ret[jss::p99_us] = std::to_string(h.percentile(0.99).count());
+    ret[jss::p999_us] = std::to_string(h.percentile(0.999).count());
+    ret[jss::max_us] = std::to_string(h.max().count());
+    return ret;
+}
+Json::Value
+PerfLogImp::Counters::histogramsJson() const
+{
+    Json::Value rpcobj(Json::objectValue);
+    LatencyHistogram totalRpc;
+    for (auto const& proc : rpc_)
+    {
+        auto const latency = [&proc]() {
+            std::lock_guard<std::mutex> lock(proc.second.mut);
+            return proc.second.latency;
+        }();
+        if (!latency.count())
+            continue;
+        rpcobj[proc.first] = latencyJson(latency);
+        totalRpc.merge(latency);
+    }
+    if (totalRpc.count())
+        rpcobj[jss::total] = latencyJson(totalRpc);
+    Json::Value jqobj(Json::objectValue);
+    LatencyHistogram totalQueued;
+    LatencyHistogram totalRunning;
+    for (auto const& proc : jq_)
+    {
+        auto const latency = [&proc]() {
+            std::lock_guard<std::mutex> lock(proc.second.mut);
+            return std::make_pair(proc.second.queuedLatency,
+                proc.second.runningLatency);
+        }();
+        if (!latency.first.count())
+            continue;
+        Json::Value j(Json::objectValue);
+        j[jss::queued] = latencyJson(latency.first);
+        totalQueued.merge(latency.first);
+        j[jss::running] = latencyJson(latency.second);
+        totalRunning.merge(latency.second);
+        jqobj[proc.second.label] = j;
+    }
+    if (totalQueued.count())
+    {
+        Json::Value totalJqJson(Json::objectValue);
+        totalJqJson[jss::queued] = latencyJson(totalQueued);
+        totalJqJson[jss::running] = latencyJson(totalRunning);
+        jqobj[jss::total] = totalJqJson;
+    }
+    Json::Value histograms(Json::objectValue);
+    histograms[jss::rpc] = rpcobj;
+    histograms[jss::job_queue] = jqobj;
+    return histograms;
+}
 void
 PerfLogImp::openLog()
 {
@@ -254,6 +315,7 @@ PerfLogImp::report()
     report[jss::counters] = counters_.countersJson();
     auto cur = counters_.currentJson();
     report[jss::current_activities] = counters_.currentJson();
+    report[jss::histograms] = counters_.histogramsJson();
     logFile_ << Json::Compact{std::move(report)} << std::endl;
 }
 PerfLogImp::PerfLogImp(Setup const& setup,
@@ -315,14 +377,15 @@ PerfLogImp::rpcEnd(std::string const& method,
             assert(false);
         }
     }
+    auto const duration = std::chrono::duration_cast<microseconds>(
+        steady_clock::now() - startTime);
     std::lock_guard<std::mutex> lock(counter->second.mut);
     if (finish)
         ++counter->second.sync.finished;
     else
         ++counter->second.sync.errored;
-    counter->second.sync.duration +=
-        std::chrono::duration_cast<microseconds>(
-            steady_clock::now() - startTime);
+    counter->second.sync.duration += duration;
+    counter->second.latency.insert(duration);
 }
 void
 PerfLogImp::jobQueue(JobType const type)
@@ -352,6 +415,7 @@ PerfLogImp::jobStart(JobType const type,
         std::lock_guard<std::mutex> lock(counter->second.mut);
         ++counter->second.sync.started;
         counter->second.sync.queuedDuration += dur;
+        counter->second.queuedLatency.insert(dur);
     }
     std::lock_guard<std::mutex> lock(counters_.jobsMutex_);
     if (instance >= 0 && instance < counters_.jobs_.size())
@@ -371,6 +435,7 @@ PerfLogImp::jobFinish(JobType const type, microseconds dur,
         std::lock_guard<std::mutex> lock(counter->second.mut);
         ++counter->second.sync.finished;
         counter->second.sync.runningDuration += dur;
+        counter->second.runningLatency.insert(dur);
     }
     std::lock_guard<std::mutex> lock(counters_.jobsMutex_);
     if (instance >= 0 && instance < counters_.jobs_.size())
@@ -1,6 +1,7 @@
 #ifndef RIPPLE_BASICS_PERFLOGIMP_H
 #define RIPPLE_BASICS_PERFLOGIMP_H
 #include <ripple/basics/chrono.h>
+#include <ripple/basics/LatencyHistogram.h>
 #include <ripple/basics/PerfLog.h>
 #include <ripple/beast/utility/Journal.h>
 #include <ripple/core/Stoppable.h>
@@ -37,6 +38,7 @@ class PerfLogImp
                 microseconds duration {0};
             };
             Sync sync;
+            LatencyHistogram latency;
             mutable std::mutex mut;
             Rpc() = default;
             Rpc(Rpc const& orig)
@@ -54,6 +56,8 @@ class PerfLogImp
                 microseconds runningDuration {0};
             };
             Sync sync;
+            LatencyHistogram queuedLatency;
+            LatencyHistogram runningLatency;
             std::string const label;
             mutable std::mutex mut;
             Jq(std::string const& labelArg)
@@ -75,6 +79,7 @@ class PerfLogImp
             JobTypes const& jobTypes);
         Json::Value countersJson() const;
         Json::Value currentJson() const;
+        Json::Value histogramsJson() const;
     };
     Setup const setup_;
     beast::Journal j_;
@@ -133,6 +138,11 @@ public:
     {
         return counters_.currentJson();
     }
+    Json::Value
+    histogramsJson() const override
+    {
+        return counters_.histogramsJson();
+    }
     void resizeJobs(int const resize) override;
     void rotate() override;
     void onPrepare() override {}
@@ -98,6 +98,8 @@ public:
     std::string                 SSL_VERIFY_FILE;
     std::string                 SSL_VERIFY_DIR;
     std::size_t                 WORKERS = 0;
+    std::size_t                 SHAMAP_FLUSH_THREADS = 0;
+    std::size_t                 SIG_VERIFY_THREADS = 0;
     boost::optional<beast::IP::Endpoint> rpc_ip;
     std::unordered_set<uint256, beast::uhash<>> features;
 public:
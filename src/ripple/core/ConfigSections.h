@@ -32,6 +32,8 @@ struct ConfigSection
 #define SECTION_PEER_PRIVATE            "peer_private"
 #define SECTION_PEERS_MAX               "peers_max"
 #define SECTION_RPC_STARTUP             "rpc_startup"
+#define SECTION_SHAMAP_FLUSH_THREADS    "shamap_flush_threads"
+#define SECTION_SIG_VERIFY_THREADS      "sig_verify_threads"
 #define SECTION_SIGNING_SUPPORT         "signing_support"
 #define SECTION_SNTP                    "sntp_servers"
 #define SECTION_SSL_VERIFY              "ssl_verify"
@@ -17,6 +17,7 @@ enum JobType
     jtCLIENT,        
     jtRPC,           
     jtUPDATE_PF,     
+    jtPATH_RANK,     
     jtTRANSACTION,   
     jtBATCH,         
     jtADVANCE,       
@@ -25,6 +26,7 @@ enum JobType
     jtWAL,           
     jtVALIDATION_t,  
     jtWRITE,         
+    jtSHAMAP_FLUSH,  
     jtACCEPT,        
     jtPROPOSAL_t,    
     jtSWEEP,         
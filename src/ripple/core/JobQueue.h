@@ -8,6 +8,10 @@
 #include <ripple/core/impl/Workers.h>
 #include <ripple/json/json_value.h>
 #include <boost/coroutine/all.hpp>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <vector>
 namespace ripple {
 namespace perf
 {
@@ -88,13 +92,21 @@ public:
 private:
     friend class Coro;
     using JobDataMap = std::map <JobType, JobTypeData>;
+    struct Shard
+    {
+        std::mutex mutex;
+        std::set <Job> jobs;
+    };
     beast::Journal m_journal;
     mutable std::mutex m_mutex;
-    std::uint64_t m_lastJob;
-    std::set <Job> m_jobSet;
+    std::atomic <std::uint64_t> m_lastJob;
+    std::vector <std::unique_ptr <Shard>> m_shards;
+    std::atomic <std::size_t> m_nextShard;
+    std::atomic <int> m_jobCount;
+    std::atomic <bool> m_stopped;
     JobDataMap m_jobData;
     JobTypeData m_invalidJobData;
-    int m_processCount;
+    std::atomic <int> m_processCount;
     int nSuspend_ = 0;
     Workers m_workers;
     Job::CancelCallback m_cancelCallback;
@@ -103,17 +115,24 @@ private:
     beast::insight::Gauge job_count;
     beast::insight::Hook hook;
     std::condition_variable cv_;
+    std::mutex m_claimMutex;
+    std::condition_variable m_claimCV;
+    std::atomic <int> m_claimWaiters;
     void collect();
     JobTypeData& getJobTypeData (JobType type);
     void onStop() override;
     void checkStopped (std::lock_guard <std::mutex> const& lock);
     bool addRefCountedJob (
         JobType type, std::string const& name, JobFunction const& func);
-    void queueJob (Job const& job, std::lock_guard <std::mutex> const& lock);
+    Shard& localShard ();
+    void queueJob (JobTypeData& data);
+    JobTypeData* tryClaimJob ();
+    JobTypeData& claimNextJob ();
+    void notifyClaimers ();
+    void popJob (JobType type, Job& job);
     void getNextJob (Job& job);
     void finishJob (JobType type);
     void processTask (int instance) override;
-    int getJobLimit (JobType type);
     void onChildrenStopped () override;
 };
 } 
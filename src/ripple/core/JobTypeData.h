@@ -3,6 +3,8 @@
 #include <ripple/basics/Log.h>
 #include <ripple/core/JobTypeInfo.h>
 #include <ripple/beast/insight/Collector.h>
+#include <atomic>
+#include <mutex>
 namespace ripple
 {
 struct JobTypeData
@@ -12,9 +14,10 @@ private:
     beast::insight::Collector::ptr m_collector;
 public:
     JobTypeInfo const& info;
-    int waiting;
-    int running;
-    int deferred;
+    std::mutex mutex;
+    std::atomic <int> waiting;
+    std::atomic <int> running;
+    std::atomic <int> deferred;
     beast::insight::Event dequeue;
     beast::insight::Event execute;
     JobTypeData (JobTypeInfo const& info_,
@@ -30,6 +30,7 @@ add(    jtLEDGER_DATA,   "ledgerData",              2,        false, 0ms,     0m
 add(    jtCLIENT,        "clientCommand",           maxLimit, false, 2000ms,  5000ms);
 add(    jtRPC,           "RPC",                     maxLimit, false, 0ms,     0ms);
 add(    jtUPDATE_PF,     "updatePaths",             maxLimit, false, 0ms,     0ms);
+add(    jtPATH_RANK,     "rankPaths",               4,        false, 0ms,     0ms);
 add(    jtTRANSACTION,   "transaction",             maxLimit, false, 250ms,   1000ms);
 add(    jtBATCH,         "batch",                   maxLimit, false, 250ms,   1000ms);
 add(    jtADVANCE,       "advanceLedger",           maxLimit, false, 0ms,     0ms);
@@ -38,6 +39,7 @@ add(    jtTXN_DATA,      "fetchTxnData",            1,        false, 0ms,     0m
 add(    jtWAL,           "writeAhead",              maxLimit, false, 1000ms,  2500ms);
 add(    jtVALIDATION_t,  "trustedValidation",       maxLimit, false, 500ms,   1500ms);
 add(    jtWRITE,         "writeObjects",            maxLimit, false, 1750ms,  2500ms);
+add(    jtSHAMAP_FLUSH,  "flushSHAMap",             maxLimit, false, 0ms,     0ms);
 add(    jtACCEPT,        "acceptLedger",            maxLimit, false, 0ms,     0ms);
 add(    jtPROPOSAL_t,    "trustedProposal",         maxLimit, false, 100ms,   500ms);
 add(    jtSWEEP,         "sweep",                   maxLimit, false, 0ms,     0ms);
@@ -288,6 +288,10 @@ void Config::loadFromString (std::string const& fileContents)
         DEBUG_LOGFILE       = strTemp;
     if (getSingleSection (secConfig, SECTION_WORKERS, strTemp, j_))
         WORKERS      = beast::lexicalCastThrow <std::size_t> (strTemp);
+    if (getSingleSection (secConfig, SECTION_SHAMAP_FLUSH_THREADS, strTemp, j_))
+        SHAMAP_FLUSH_THREADS = beast::lexicalCastThrow <std::size_t> (strTemp);
+    if (getSingleSection (secConfig, SECTION_SIG_VERIFY_THREADS, strTemp, j_))
+        SIG_VERIFY_THREADS = beast::lexicalCastThrow <std::size_t> (strTemp);
     if (! RUN_STANDALONE)
     {
         boost::filesystem::path validatorsFile;
@@ -2,22 +2,35 @@
 #include <ripple/core/JobQueue.h>
 #include <ripple/basics/contract.h>
 #include <ripple/basics/PerfLog.h>
+#include <algorithm>
+#include <thread>
 namespace ripple {
+namespace {
+thread_local int workerInstance = -1;
+}
 JobQueue::JobQueue (beast::insight::Collector::ptr const& collector,
     Stoppable& parent, beast::Journal journal, Logs& logs,
     perf::PerfLog& perfLog)
     : Stoppable ("JobQueue", parent)
     , m_journal (journal)
     , m_lastJob (0)
+    , m_nextShard (0)
+    , m_jobCount (0)
+    , m_stopped (false)
     , m_invalidJobData (JobTypes::instance().getInvalid (), collector, logs)
     , m_processCount (0)
     , m_workers (*this, perfLog, "JobQueue", 0)
     , m_cancelCallback (std::bind (&Stoppable::isStopping, this))
     , perfLog_ (perfLog)
     , m_collector (collector)
+    , m_claimWaiters (0)
 {
     hook = m_collector->make_hook (std::bind (&JobQueue::collect, this));
     job_count = m_collector->make_gauge ("job_count");
+    auto const shards = std::max (1u, std::thread::hardware_concurrency ());
+    m_shards.reserve (shards);
+    for (unsigned i = 0; i < shards; ++i)
+        m_shards.push_back (std::make_unique <Shard> ());
     {
         std::lock_guard <std::mutex> lock (m_mutex);
         for (auto const& x : JobTypes::instance())
@@ -38,8 +51,7 @@ JobQueue::~JobQueue ()
 void
 JobQueue::collect ()
 {
-    std::lock_guard <std::mutex> lock (m_mutex);
-    job_count = m_jobSet.size ();
+    job_count = m_jobCount;
 }
 bool
 JobQueue::addRefCountedJob (JobType type, std::string const& name,
@@ -52,32 +64,40 @@ JobQueue::addRefCountedJob (JobType type, std::string const& name,
         return false;
     JobTypeData& data (iter->second);
     assert (type == jtCLIENT || m_workers.getNumberOfThreads () > 0);
+    assert (! isStopped() && (
+        m_processCount>0 ||
+        m_jobCount>0 ||
+        ! areChildrenStopped()));
+    ++m_jobCount;
+    if (m_stopped)
     {
         std::lock_guard <std::mutex> lock (m_mutex);
-        assert (! isStopped() && (
-            m_processCount>0 ||
-            ! m_jobSet.empty () ||
-            ! areChildrenStopped()));
-        std::pair <std::set <Job>::iterator, bool> result (
-            m_jobSet.insert (Job (type, name, ++m_lastJob,
-                data.load (), func, m_cancelCallback)));
-        queueJob (*result.first, lock);
+        if (m_stopped)
+        {
+            --m_jobCount;
+            return false;
+        }
     }
+    {
+        Shard& shard (localShard ());
+        std::lock_guard <std::mutex> lock (shard.mutex);
+        shard.jobs.emplace (type, name, ++m_lastJob,
+            data.load (), func, m_cancelCallback);
+    }
+    queueJob (data);
     return true;
 }
 int
 JobQueue::getJobCount (JobType t) const
 {
-    std::lock_guard <std::mutex> lock (m_mutex);
     JobDataMap::const_iterator c = m_jobData.find (t);
     return (c == m_jobData.end ())
         ? 0
-        : c->second.waiting;
+        : c->second.waiting.load ();
 }
 int
 JobQueue::getJobCountTotal (JobType t) const
 {
-    std::lock_guard <std::mutex> lock (m_mutex);
     JobDataMap::const_iterator c = m_jobData.find (t);
     return (c == m_jobData.end ())
         ? 0
@@ -87,7 +107,6 @@ int
 JobQueue::getJobCountGE (JobType t) const
 {
     int ret = 0;
-    std::lock_guard <std::mutex> lock (m_mutex);
     for (auto const& x : m_jobData)
     {
         if (x.first >= t)
@@ -153,7 +172,6 @@ JobQueue::getJson (int c)
     Json::Value ret (Json::objectValue);
     ret["threads"] = m_workers.getNumberOfThreads ();
     Json::Value priorities = Json::arrayValue;
-    std::lock_guard <std::mutex> lock (m_mutex);
     for (auto& x : m_jobData)
     {
         assert (x.first != jtINVALID);
@@ -192,7 +210,7 @@ JobQueue::rendezvous()
     cv_.wait(lock, [&]
     {
         return m_processCount == 0 &&
-            m_jobSet.empty();
+            m_jobCount == 0;
     });
 }
 JobTypeData&
@@ -211,73 +229,150 @@ JobQueue::onStop()
 void
 JobQueue::checkStopped (std::lock_guard <std::mutex> const& lock)
 {
-    if (isStopping() &&
-        areChildrenStopped() &&
-        (m_processCount == 0) &&
-        m_jobSet.empty() &&
-        nSuspend_ == 0)
+    if (m_stopped || ! isStopping() || ! areChildrenStopped() ||
+        nSuspend_ != 0)
     {
-        stopped();
+        return;
     }
+    m_stopped = true;
+    if ((m_jobCount == 0) && (m_processCount == 0))
+        stopped();
+    else
+        m_stopped = false;
+}
+JobQueue::Shard&
+JobQueue::localShard ()
+{
+    if (workerInstance >= 0)
+        return *m_shards[workerInstance % m_shards.size ()];
+    return *m_shards[m_nextShard++ % m_shards.size ()];
 }
 void
-JobQueue::queueJob (Job const& job, std::lock_guard <std::mutex> const& lock)
+JobQueue::queueJob (JobTypeData& data)
 {
-    JobType const type (job.getType ());
+    JobType const type (data.type ());
     assert (type != jtINVALID);
-    assert (m_jobSet.find (job) != m_jobSet.end ());
     perfLog_.jobQueue(type);
-    JobTypeData& data (getJobTypeData (type));
-    if (data.waiting + data.running < getJobLimit (type))
+    bool addTask = false;
     {
+        std::lock_guard <std::mutex> lock (data.mutex);
+        if (data.waiting + data.running < data.info.limit ())
+            addTask = true;
+        else
+            ++data.deferred;
+        ++data.waiting;
+    }
+    if (addTask)
         m_workers.addTask ();
+    notifyClaimers ();
+}
+JobTypeData*
+JobQueue::tryClaimJob ()
+{
+    for (auto iter = m_jobData.rbegin (); iter != m_jobData.rend (); ++iter)
+    {
+        JobTypeData& data (iter->second);
+        int const limit = data.info.limit ();
+        if (data.waiting == 0 || data.running >= limit)
+            continue;
+        std::lock_guard <std::mutex> lock (data.mutex);
+        if (data.waiting > 0 && data.running < limit)
+        {
+            --data.waiting;
+            ++data.running;
+            return &data;
+        }
     }
-    else
+    return nullptr;
+}
+JobTypeData&
+JobQueue::claimNextJob ()
+{
+    if (auto data = tryClaimJob ())
+        return *data;
+    std::unique_lock <std::mutex> lock (m_claimMutex);
+    ++m_claimWaiters;
+    JobTypeData* data = nullptr;
+    m_claimCV.wait (lock, [&]
+    {
+        data = tryClaimJob ();
+        return data != nullptr;
+    });
+    --m_claimWaiters;
+    return *data;
+}
+void
+JobQueue::notifyClaimers ()
+{
+    if (m_claimWaiters > 0)
     {
-        ++data.deferred;
+        std::lock_guard <std::mutex> lock (m_claimMutex);
+        m_claimCV.notify_all ();
     }
-    ++data.waiting;
 }
 void
-JobQueue::getNextJob (Job& job)
+JobQueue::popJob (JobType type, Job& job)
 {
-    assert (! m_jobSet.empty ());
-    std::set <Job>::const_iterator iter;
-    for (iter = m_jobSet.begin (); iter != m_jobSet.end (); ++iter)
+    auto take = [&](Shard& shard)
     {
-        JobTypeData& data (getJobTypeData (iter->getType ()));
-        assert (data.running <= getJobLimit (data.type ()));
-        if (data.running < getJobLimit (data.type ()))
-        {
-            assert (data.waiting > 0);
-            break;
-        }
+        auto iter = shard.jobs.lower_bound (Job (type, 0));
+        if (iter == shard.jobs.end () || iter->getType () != type)
+            return false;
+        job = *iter;
+        shard.jobs.erase (iter);
+        return true;
+    };
+    std::size_t const first = workerInstance >= 0 ? workerInstance : 0;
+    for (std::size_t i = 0; i < m_shards.size (); ++i)
+    {
+        Shard& shard (*m_shards[(first + i) % m_shards.size ()]);
+        std::lock_guard <std::mutex> lock (shard.mutex);
+        if (take (shard))
+            return;
     }
-    assert (iter != m_jobSet.end ());
-    JobType const type = iter->getType ();
-    JobTypeData& data (getJobTypeData (type));
-    assert (type != jtINVALID);
-    job = *iter;
-    m_jobSet.erase (iter);
-    --data.waiting;
-    ++data.running;
+    std::vector <std::unique_lock <std::mutex>> locks;
+    locks.reserve (m_shards.size ());
+    for (auto& shard : m_shards)
+        locks.emplace_back (shard->mutex);
+    for (auto& shard : m_shards)
+    {
+        if (take (*shard))
+            return;
+    }
+    LogicError ("JobQueue::popJob : no job of the claimed type");
+}
+void
+JobQueue::getNextJob (Job& job)
+{
+    JobTypeData& data (claimNextJob ());
+    assert (data.type () != jtINVALID);
+    popJob (data.type (), job);
+    --m_jobCount;
 }
 void
 JobQueue::finishJob (JobType type)
 {
     assert(type != jtINVALID);
     JobTypeData& data = getJobTypeData (type);
-    if (data.deferred > 0)
+    bool addTask = false;
     {
-        assert (data.running + data.waiting >= getJobLimit (type));
-        --data.deferred;
-        m_workers.addTask ();
+        std::lock_guard <std::mutex> lock (data.mutex);
+        if (data.deferred > 0)
+        {
+            assert (data.running + data.waiting >= data.info.limit ());
+            --data.deferred;
+            addTask = true;
+        }
+        --data.running;
     }
-    --data.running;
+    if (addTask)
+        m_workers.addTask ();
+    notifyClaimers ();
 }
 void
 JobQueue::processTask (int instance)
 {
+    workerInstance = instance;
     JobType type;
     {
         using namespace std::chrono;
@@ -285,11 +380,8 @@ JobQueue::processTask (int instance)
             Job::clock_type::now());
         {
             Job job;
-            {
-                std::lock_guard <std::mutex> lock (m_mutex);
-                getNextJob (job);
-                ++m_processCount;
-            }
+            ++m_processCount;
+            getNextJob (job);
             type = job.getType();
             JobTypeData& data(getJobTypeData(type));
             JLOG(m_journal.trace()) << "Doing " << data.name () << " job";
@@ -306,21 +398,15 @@ JobQueue::processTask (int instance)
         if (us >= 10ms)
             getJobTypeData(type).execute.notify(us);
     }
+    finishJob (type);
+    if (--m_processCount == 0)
     {
         std::lock_guard <std::mutex> lock (m_mutex);
-        finishJob (type);
-        if(--m_processCount == 0 && m_jobSet.empty())
+        if (m_jobCount == 0)
             cv_.notify_all();
         checkStopped (lock);
     }
 }
-int
-JobQueue::getJobLimit (JobType type)
-{
-    JobTypeInfo const& j (JobTypes::instance().get (type));
-    assert (j.type () != jtINVALID);
-    return j.limit ();
-}
 void
 JobQueue::onChildrenStopped ()
 {
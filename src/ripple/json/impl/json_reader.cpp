@@ -309,10 +309,23 @@ Reader::readString ()
 }
 bool
 Reader::readObject(Token& tokenStart, unsigned depth)
+{
+    currentValue () = Value ( objectValue );
+    Value& object = currentValue ();
+    bool const ok = readMembers ( depth );
+    auto const duplicate = object.sortMembers ();
+    if ( ok  &&  duplicate )
+    {
+        return addError ( "Key '" + std::string ( duplicate ) +
+            "' appears twice.", tokenStart );
+    }
+    return ok;
+}
+bool
+Reader::readMembers(unsigned depth)
 {
     Token tokenName;
     std::string name;
-    currentValue () = Value ( objectValue );
     while ( readToken ( tokenName ) )
     {
         bool initialTokenOk = true;
@@ -334,9 +347,7 @@ Reader::readObject(Token& tokenStart, unsigned depth)
                                         colon,
                                         tokenObjectEnd );
         }
-        if (currentValue ().isMember (name))
-            return addError ( "Key '" + name + "' appears twice.", tokenName );
-        Value& value = currentValue ()[ name ];
+        Value& value = currentValue ().appendMember ( name );
         nodes_.push ( &value );
         bool ok = readValue(depth+1);
         nodes_.pop ();
@@ -4,6 +4,7 @@
 #include <ripple/json/to_string.h>
 #include <ripple/json/json_writer.h>
 #include <ripple/beast/core/LexicalCast.h>
+#include <algorithm>
 namespace Json {
 const Value Value::null;
 const Int Value::minInt = Int ( ~ (UInt (-1) / 2) );
@@ -69,6 +70,12 @@ Value::CZString::CZString ( const CZString& other )
                : other.index_ )
 {
 }
+Value::CZString::CZString ( CZString&& other ) noexcept
+    : cstr_ ( other.cstr_ )
+    , index_ ( other.index_ )
+{
+    other.cstr_ = 0;
+}
 Value::CZString::~CZString ()
 {
     if ( cstr_  &&  index_ == duplicate )
@@ -87,6 +94,13 @@ Value::CZString::operator = ( const CZString& other )
     swap ( temp );
     return *this;
 }
+Value::CZString&
+Value::CZString::operator = ( CZString&& other ) noexcept
+{
+    CZString temp ( std::move ( other ) );
+    swap ( temp );
+    return *this;
+}
 bool
 Value::CZString::operator< ( const CZString& other ) const
 {
@@ -117,9 +131,150 @@ Value::CZString::isStaticString () const
     return index_ == noDuplication;
 }
 
+Value::ObjectValues::ObjectValues ( const ObjectValues& other )
+{
+    if ( other.empty () )
+        return;
+    addBlock ( other.size () );
+    entries_.reserve ( other.size () );
+    for ( auto const& entry : other.entries_ )
+    {
+        Value* value = allocate ();
+        *value = *entry.second;
+        entries_.push_back ( { entry.first, value } );
+    }
+}
+Value::ObjectValues::iterator
+Value::ObjectValues::lower_bound ( const CZString& key )
+{
+    return std::lower_bound ( entries_.begin (), entries_.end (), key,
+        [](value_type const& entry, CZString const& k)
+        {
+            return entry.first < k;
+        });
+}
+Value::ObjectValues::iterator
+Value::ObjectValues::find ( const CZString& key )
+{
+    iterator it = lower_bound ( key );
+    if ( it != entries_.end ()  &&  (*it).first == key )
+        return it;
+    return entries_.end ();
+}
+Value::ObjectValues::const_iterator
+Value::ObjectValues::find ( const CZString& key ) const
+{
+    return const_cast<ObjectValues*> ( this )->find ( key );
+}
+Value::ObjectValues::iterator
+Value::ObjectValues::insert ( iterator hint, const CZString& key )
+{
+    auto const offset = hint - entries_.begin ();
+    Value* value = allocate ();
+    return entries_.insert ( entries_.begin () + offset, { key, value } );
+}
+Value::ObjectValues::iterator
+Value::ObjectValues::append ( const CZString& key )
+{
+    Value* value = allocate ();
+    entries_.push_back ( { key, value } );
+    return entries_.end () - 1;
+}
+Value::ObjectValues::const_iterator
+Value::ObjectValues::sort ()
+{
+    std::stable_sort ( entries_.begin (), entries_.end (),
+        [](value_type const& a, value_type const& b)
+        {
+            return a.first < b.first;
+        });
+    auto duplicate = entries_.size ();
+    std::size_t out = 0;
+    for ( std::size_t i = 0; i < entries_.size (); ++i )
+    {
+        if ( out != 0  &&  entries_[out - 1].first == entries_[i].first )
+        {
+            *entries_[out - 1].second = Value ();
+            free_.push_back ( entries_[out - 1].second );
+            entries_[out - 1] = std::move ( entries_[i] );
+            if ( duplicate == entries_.size () )
+                duplicate = out - 1;
+        }
+        else if ( out++ != i )
+        {
+            entries_[out - 1] = std::move ( entries_[i] );
+        }
+    }
+    entries_.erase ( entries_.begin () + out, entries_.end () );
+    if ( duplicate >= out )
+        return entries_.end ();
+    return entries_.begin () + duplicate;
+}
+void
+Value::ObjectValues::erase ( iterator it )
+{
+    *(*it).second = Value ();
+    free_.push_back ( (*it).second );
+    entries_.erase ( it );
+}
+void
+Value::ObjectValues::clear ()
+{
+    entries_.clear ();
+    blocks_.clear ();
+    free_.clear ();
+    used_ = 0;
+    capacity_ = 0;
+}
+Value*
+Value::ObjectValues::allocate ()
+{
+    if ( ! free_.empty () )
+    {
+        Value* value = free_.back ();
+        free_.pop_back ();
+        return value;
+    }
+    if ( used_ == capacity_ )
+        addBlock ( capacity_ ? capacity_ * 2 : 4 );
+    return &blocks_.back ()[used_++];
+}
+void
+Value::ObjectValues::addBlock ( std::size_t size )
+{
+    blocks_.emplace_back ( new Value[size] );
+    entries_.reserve ( entries_.size () + size );
+    used_ = 0;
+    capacity_ = size;
+}
+bool operator== ( const Value::ObjectValues& x, const Value::ObjectValues& y )
+{
+    return std::equal ( x.begin (), x.end (), y.begin (), y.end (),
+        [](Value::ObjectValues::value_type const& a,
+           Value::ObjectValues::value_type const& b)
+        {
+            return a.first == b.first  &&  *a.second == *b.second;
+        });
+}
+bool operator< ( const Value::ObjectValues& x, const Value::ObjectValues& y )
+{
+    return std::lexicographical_compare ( x.begin (), x.end (),
+        y.begin (), y.end (),
+        [](Value::ObjectValues::value_type const& a,
+           Value::ObjectValues::value_type const& b)
+        {
+            if ( a.first < b.first )
+                return true;
+            if ( b.first < a.first )
+                return false;
+            return *a.second < *b.second;
+        });
+}
+
 Value::Value ( ValueType type )
     : type_ ( type )
     , allocated_ ( 0 )
+    , inlined_ ( 0 )
 {
     switch ( type )
     {
@@ -163,28 +318,24 @@ Value::Value ( double value )
 }
 Value::Value ( const char* value )
     : type_ ( stringValue )
-    , allocated_ ( true )
 {
-    value_.string_ = valueAllocator ()->duplicateStringValue ( value );
+    setString ( value, value ? (unsigned int)strlen ( value ) : 0 );
 }
 Value::Value ( const char* beginValue,
                const char* endValue )
     : type_ ( stringValue )
-    , allocated_ ( true )
 {
-    value_.string_ = valueAllocator ()->duplicateStringValue ( beginValue,
-                     UInt (endValue - beginValue) );
+    setString ( beginValue, UInt (endValue - beginValue) );
 }
 Value::Value ( std::string const& value )
     : type_ ( stringValue )
-    , allocated_ ( true )
 {
-    value_.string_ = valueAllocator ()->duplicateStringValue ( value.c_str (),
-                     (unsigned int)value.length () );
+    setString ( value.c_str (), (unsigned int)value.length () );
 }
 Value::Value ( const StaticString& value )
     : type_ ( stringValue )
     , allocated_ ( false )
+    , inlined_ ( false )
 {
     value_.string_ = const_cast<char*> ( value.c_str () );
 }
@@ -195,6 +346,8 @@ Value::Value ( bool value )
 }
 Value::Value ( const Value& other )
     : type_ ( other.type_ )
+    , allocated_ ( 0 )
+    , inlined_ ( 0 )
 {
     switch ( type_ )
     {
@@ -206,13 +359,18 @@ Value::Value ( const Value& other )
         value_ = other.value_;
         break;
     case stringValue:
-        if ( other.value_.string_ )
+        if ( other.inlined_ )
+        {
+            value_ = other.value_;
+            inlined_ = true;
+        }
+        else if ( other.allocated_ )
         {
             value_.string_ = valueAllocator ()->duplicateStringValue ( other.value_.string_ );
             allocated_ = true;
         }
         else
-            value_.string_ = 0;
+            value_.string_ = other.value_.string_;
         break;
     case arrayValue:
     case objectValue:
@@ -256,9 +414,11 @@ Value::Value ( Value&& other ) noexcept
     : value_ ( other.value_ )
     , type_ ( other.type_ )
     , allocated_ ( other.allocated_ )
+    , inlined_ ( other.inlined_ )
 {
     other.type_ = nullValue;
     other.allocated_ = 0;
+    other.inlined_ = 0;
 }
 Value&
 Value::operator=(Value&& other)
@@ -277,6 +437,27 @@ Value::swap ( Value& other ) noexcept
     int temp2 = allocated_;
     allocated_ = other.allocated_;
     other.allocated_ = temp2;
+    temp2 = inlined_;
+    inlined_ = other.inlined_;
+    other.inlined_ = temp2;
+}
+void
+Value::setString ( const char* value, unsigned int length )
+{
+    if ( length < inlineStringSize )
+    {
+        if ( length != 0 )
+            memcpy ( value_.chars_, value, length );
+        value_.chars_[length] = 0;
+        allocated_ = false;
+        inlined_ = true;
+    }
+    else
+    {
+        value_.string_ = valueAllocator ()->duplicateStringValue ( value, length );
+        allocated_ = true;
+        inlined_ = false;
+    }
 }
 ValueType
 Value::type () const
@@ -313,9 +494,12 @@ bool operator < (const Value& x, const Value& y)
     case booleanValue:
         return x.value_.bool_ < y.value_.bool_;
     case stringValue:
-        return (x.value_.string_ == 0  &&  y.value_.string_)
-               || (y.value_.string_ && x.value_.string_ &&
-                   strcmp (x.value_.string_, y.value_.string_) < 0);
+    {
+        auto const xs = x.asCString ();
+        auto const ys = y.asCString ();
+        return (xs == 0  &&  ys)
+               || (ys && xs && strcmp (xs, ys) < 0);
+    }
     case arrayValue:
     case objectValue:
     {
@@ -351,9 +535,12 @@ bool operator== (const Value& x, const Value& y)
     case booleanValue:
         return x.value_.bool_ == y.value_.bool_;
     case stringValue:
-        return x.value_.string_ == y.value_.string_
-               || (y.value_.string_ && x.value_.string_ &&
-                    ! strcmp (x.value_.string_, y.value_.string_));
+    {
+        auto const xs = x.asCString ();
+        auto const ys = y.asCString ();
+        return xs == ys
+               || (ys && xs && ! strcmp (xs, ys));
+    }
     case arrayValue:
     case objectValue:
         return x.value_.map_->size () == y.value_.map_->size ()
@@ -367,7 +554,7 @@ const char*
 Value::asCString () const
 {
     JSON_ASSERT ( type_ == stringValue );
-    return value_.string_;
+    return inlined_ ? value_.chars_ : value_.string_;
 }
 std::string
 Value::asString () const
@@ -377,7 +564,7 @@ Value::asString () const
     case nullValue:
         return "";
     case stringValue:
-        return value_.string_ ? value_.string_ : "";
+        return asCString () ? asCString () : "";
     case booleanValue:
         return value_.bool_ ? "true" : "false";
     case intValue:
@@ -412,7 +599,7 @@ Value::asInt () const
     case booleanValue:
         return value_.bool_ ? 1 : 0;
     case stringValue:
-        return beast::lexicalCastThrow <int> (value_.string_);
+        return beast::lexicalCastThrow <int> (asCString ());
     case arrayValue:
     case objectValue:
         JSON_ASSERT_MESSAGE ( false, "Type is not convertible to int" );
@@ -439,7 +626,7 @@ Value::asUInt () const
     case booleanValue:
         return value_.bool_ ? 1 : 0;
     case stringValue:
-        return beast::lexicalCastThrow <unsigned int> (value_.string_);
+        return beast::lexicalCastThrow <unsigned int> (asCString ());
     case arrayValue:
     case objectValue:
         JSON_ASSERT_MESSAGE ( false, "Type is not convertible to uint" );
@@ -487,7 +674,7 @@ Value::asBool () const
     case booleanValue:
         return value_.bool_;
     case stringValue:
-        return value_.string_  &&  value_.string_[0] != 0;
+        return asCString ()  &&  asCString ()[0] != 0;
     case arrayValue:
     case objectValue:
         return value_.map_->size () != 0;
@@ -533,7 +720,7 @@ Value::isConvertibleTo ( ValueType other ) const
                || other == booleanValue;
     case stringValue:
         return other == stringValue
-               || ( other == nullValue  &&  (!value_.string_  ||  value_.string_[0] == 0) );
+               || ( other == nullValue  &&  (!asCString ()  ||  asCString ()[0] == 0) );
     case arrayValue:
         return other == arrayValue
                ||  ( other == nullValue  &&  value_.map_->size () == 0 );
@@ -611,7 +798,11 @@ Value::resize ( UInt newSize )
     else
     {
         for ( UInt index = newSize; index < oldSize; ++index )
-            value_.map_->erase ( index );
+        {
+            ObjectValues::iterator it = value_.map_->find ( index );
+            if ( it != value_.map_->end () )
+                value_.map_->erase ( it );
+        }
         assert ( size () == newSize );
     }
 }
@@ -624,10 +815,9 @@ Value::operator[] ( UInt index )
     CZString key ( index );
     ObjectValues::iterator it = value_.map_->lower_bound ( key );
     if ( it != value_.map_->end ()  &&  (*it).first == key )
-        return (*it).second;
-    ObjectValues::value_type defaultValue ( key, null );
-    it = value_.map_->insert ( it, defaultValue );
-    return (*it).second;
+        return *(*it).second;
+    it = value_.map_->insert ( it, key );
+    return *(*it).second;
 }
 const Value&
 Value::operator[] ( UInt index ) const
@@ -639,7 +829,7 @@ Value::operator[] ( UInt index ) const
     ObjectValues::const_iterator it = value_.map_->find ( key );
     if ( it == value_.map_->end () )
         return null;
-    return (*it).second;
+    return *(*it).second;
 }
 Value&
 Value::operator[] ( const char* key )
@@ -657,12 +847,27 @@ Value::resolveReference ( const char* key,
                          : CZString::duplicateOnCopy );
     ObjectValues::iterator it = value_.map_->lower_bound ( actualKey );
     if ( it != value_.map_->end ()  &&  (*it).first == actualKey )
-        return (*it).second;
-    ObjectValues::value_type defaultValue ( actualKey, null );
-    it = value_.map_->insert ( it, defaultValue );
-    Value& value = (*it).second;
+        return *(*it).second;
+    it = value_.map_->insert ( it, actualKey );
+    Value& value = *(*it).second;
     return value;
 }
+Value&
+Value::appendMember ( std::string const& key )
+{
+    JSON_ASSERT ( type_ == objectValue );
+    CZString actualKey ( key.c_str (), CZString::duplicateOnCopy );
+    return *(*value_.map_->append ( actualKey )).second;
+}
+const char*
+Value::sortMembers ()
+{
+    JSON_ASSERT ( type_ == objectValue );
+    auto const it = value_.map_->sort ();
+    if ( it == value_.map_->end () )
+        return nullptr;
+    return (*it).first.c_str ();
+}
 Value
 Value::get ( UInt index,
              const Value& defaultValue ) const
@@ -685,7 +890,7 @@ Value::operator[] ( const char* key ) const
     ObjectValues::const_iterator it = value_.map_->find ( actualKey );
     if ( it == value_.map_->end () )
         return null;
-    return (*it).second;
+    return *(*it).second;
 }
 Value&
 Value::operator[] ( std::string const& key )
@@ -730,7 +935,7 @@ Value::removeMember ( const char* key )
     ObjectValues::iterator it = value_.map_->find ( actualKey );
     if ( it == value_.map_->end () )
         return null;
-    Value old (it->second);
+    Value old (std::move (*it->second));
     value_.map_->erase (it);
     return old;
 }
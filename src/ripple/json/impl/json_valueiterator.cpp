@@ -14,7 +14,7 @@ ValueIteratorBase::ValueIteratorBase ( const Value::ObjectValues::iterator& curr
 Value&
 ValueIteratorBase::deref () const
 {
-    return current_->second;
+    return *current_->second;
 }
 void
 ValueIteratorBase::increment ()
@@ -57,7 +57,7 @@ ValueIteratorBase::copy ( const SelfType& other )
 Value
 ValueIteratorBase::key () const
 {
-    const Value::CZString czstring = (*current_).first;
+    const Value::CZString& czstring = (*current_).first;
     if ( czstring.c_str () )
     {
         if ( czstring.isStaticString () )
@@ -69,7 +69,7 @@ ValueIteratorBase::key () const
 UInt
 ValueIteratorBase::index () const
 {
-    const Value::CZString czstring = (*current_).first;
+    const Value::CZString& czstring = (*current_).first;
     if ( !czstring.c_str () )
         return czstring.index ();
     return Value::UInt ( -1 );
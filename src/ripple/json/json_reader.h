@@ -69,6 +69,7 @@ private:
     Reader::TokenType readNumber ();
     bool readValue(unsigned depth);
     bool readObject(Token& token, unsigned depth);
+    bool readMembers(unsigned depth);
     bool readArray (Token& token, unsigned depth);
     bool decodeNumber ( Token& token );
     bool decodeString ( Token& token );
@@ -4,6 +4,7 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 namespace Json
@@ -68,9 +69,11 @@ inline bool operator!= (StaticString x, std::string const& y)
 {
     return ! (y == x);
 }
+class Reader;
 class Value
 {
     friend class ValueIteratorBase;
+    friend class Reader;
 public:
     using Members = std::vector<std::string>;
     using iterator = ValueIterator;
@@ -95,8 +98,10 @@ private:
         CZString ( int index );
         CZString ( const char* cstr, DuplicationPolicy allocate );
         CZString ( const CZString& other );
+        CZString ( CZString&& other ) noexcept;
         ~CZString ();
         CZString& operator = ( const CZString& other );
+        CZString& operator = ( CZString&& other ) noexcept;
         bool operator< ( const CZString& other ) const;
         bool operator== ( const CZString& other ) const;
         int index () const;
@@ -108,7 +113,7 @@ private:
         int index_;
     };
 public:
-    using ObjectValues = std::map<CZString, Value>;
+    class ObjectValues;
 public:
     Value ( ValueType type = nullValue );
     Value ( Int value );
@@ -182,7 +187,11 @@ public:
 private:
     Value& resolveReference ( const char* key,
                               bool isStatic );
+    Value& appendMember ( std::string const& key );
+    const char* sortMembers ();
+    void setString ( const char* value, unsigned int length );
 private:
+    static constexpr unsigned int inlineStringSize = 16;
     union ValueHolder
     {
         Int int_;
@@ -190,10 +199,70 @@ private:
         double real_;
         bool bool_;
         char* string_;
+        char chars_[inlineStringSize];
         ObjectValues* map_ {nullptr};
     } value_;
     ValueType type_ : 8;
     int allocated_ : 1;     
+    int inlined_ : 1;
+};
+// Members are kept sorted by key in a vector, so insert and erase
+// invalidate iterators. References to member values stay valid.
+class Value::ObjectValues
+{
+public:
+    struct value_type
+    {
+        CZString first;
+        Value* second;
+    };
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+    ObjectValues () = default;
+    ObjectValues ( const ObjectValues& other );
+    ObjectValues& operator= ( const ObjectValues& other ) = delete;
+    bool empty () const
+    {
+        return entries_.empty ();
+    }
+    std::size_t size () const
+    {
+        return entries_.size ();
+    }
+    iterator begin ()
+    {
+        return entries_.begin ();
+    }
+    iterator end ()
+    {
+        return entries_.end ();
+    }
+    const_iterator begin () const
+    {
+        return entries_.begin ();
+    }
+    const_iterator end () const
+    {
+        return entries_.end ();
+    }
+    iterator lower_bound ( const CZString& key );
+    iterator find ( const CZString& key );
+    const_iterator find ( const CZString& key ) const;
+    iterator insert ( iterator hint, const CZString& key );
+    iterator append ( const CZString& key );
+    const_iterator sort ();
+    void erase ( iterator it );
+    void clear ();
+    friend bool operator== ( const ObjectValues&, const ObjectValues& );
+    friend bool operator< ( const ObjectValues&, const ObjectValues& );
+private:
+    Value* allocate ();
+    void addBlock ( std::size_t size );
+    std::vector<value_type> entries_;
+    std::vector<std::unique_ptr<Value[]>> blocks_;
+    std::vector<Value*> free_;
+    std::size_t used_ = 0;
+    std::size_t capacity_ = 0;
 };
 bool operator== (const Value&, const Value&);
 inline
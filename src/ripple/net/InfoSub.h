@@ -6,7 +6,11 @@
 #include <ripple/resource/Consumer.h>
 #include <ripple/protocol/Book.h>
 #include <ripple/core/Stoppable.h>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <string>
 namespace ripple {
 class PathRequest;
 class InfoSub
@@ -18,6 +22,28 @@ public:
     using wptr = std::weak_ptr<InfoSub>;
     using ref = const std::shared_ptr<InfoSub>&;
     using Consumer = Resource::Consumer;
+    class Message
+    {
+    public:
+        using Builder = std::function<Json::Value ()>;
+        explicit Message (Json::Value const& jvObj);
+        Message (Builder json, Builder binary);
+        Message (Message const&) = delete;
+        Message& operator= (Message const&) = delete;
+        Json::Value const& json (bool binary = false) const;
+        std::shared_ptr<std::string const> const& text (
+            bool binary = false) const;
+    private:
+        struct Form
+        {
+            Builder build;
+            Json::Value const* jvObj = nullptr;
+            Json::Value owned;
+            std::shared_ptr<std::string const> text;
+        };
+        Form& form (bool binary) const;
+        Form mutable forms_[2];
+    };
 public:
     class Source : public Stoppable
     {
@@ -62,7 +88,10 @@ public:
     virtual ~InfoSub ();
     Consumer& getConsumer();
     virtual void send (Json::Value const& jvObj, bool broadcast) = 0;
+    virtual void send (Message const& msg, bool broadcast);
     std::uint64_t getSeq ();
+    void setBinary (bool binary);
+    bool isBinary () const;
     void onSendEmpty ();
     void insertSubAccountInfo (
         AccountID const& account,
@@ -84,6 +113,7 @@ private:
     hash_set <AccountID> normalSubscriptions_;
     std::shared_ptr <PathRequest> mPathRequest;
     std::uint64_t                 mSeq;
+    std::atomic<bool>             binary_ {false};
     static
     int
     assign_id()
@@ -19,6 +19,7 @@ class SSLHTTPDownloader
 {
 public:
     using error_code = boost::system::error_code;
+    using Writer = std::function<void(void const*, std::size_t)>;
     SSLHTTPDownloader(
         boost::asio::io_service& io_service,
         beast::Journal j);
@@ -32,6 +33,15 @@ public:
         int version,
         boost::filesystem::path const& dstPath,
         std::function<void(boost::filesystem::path)> complete);
+    bool
+    stream(
+        std::string const& host,
+        std::string const& port,
+        std::string const& target,
+        int version,
+        boost::filesystem::path const& dstDir,
+        Writer writer,
+        std::function<void(boost::filesystem::path)> complete);
 private:
     boost::asio::ssl::context ctx_;
     boost::asio::io_service::strand strand_;
@@ -41,12 +51,22 @@ private:
     bool ssl_verify_;
     beast::Journal j_;
     void
+    spawn(
+        std::string const& host,
+        std::string const& port,
+        std::string const& target,
+        int version,
+        boost::filesystem::path const& dstPath,
+        Writer const& writer,
+        std::function<void(boost::filesystem::path)> const& complete);
+    void
     do_session(
         std::string host,
         std::string port,
         std::string target,
         int version,
         boost::filesystem::path dstPath,
+        Writer writer,
         std::function<void(boost::filesystem::path)> complete,
         boost::asio::yield_context yield);
     void
@@ -1,11 +1,53 @@
 
 #include <ripple/net/InfoSub.h>
+#include <ripple/json/json_writer.h>
 #include <atomic>
 namespace ripple {
 InfoSub::Source::Source (char const* name, Stoppable& parent)
     : Stoppable (name, parent)
 {
 }
+InfoSub::Message::Message (Json::Value const& jvObj)
+{
+    forms_[0].jvObj = &jvObj;
+}
+InfoSub::Message::Message (Builder json, Builder binary)
+{
+    forms_[0].build = std::move (json);
+    forms_[1].build = std::move (binary);
+}
+InfoSub::Message::Form&
+InfoSub::Message::form (bool binary) const
+{
+    auto& f = forms_[binary && forms_[1].build ? 1 : 0];
+    if (! f.jvObj)
+    {
+        f.owned = f.build ();
+        f.jvObj = &f.owned;
+    }
+    return f;
+}
+Json::Value const&
+InfoSub::Message::json (bool binary) const
+{
+    return *form (binary).jvObj;
+}
+std::shared_ptr<std::string const> const&
+InfoSub::Message::text (bool binary) const
+{
+    auto& f = form (binary);
+    if (! f.text)
+    {
+        auto s = std::make_shared<std::string> ();
+        Json::stream (*f.jvObj,
+            [&s](void const* data, std::size_t n)
+            {
+                s->append (static_cast<char const*>(data), n);
+            });
+        f.text = std::move (s);
+    }
+    return f.text;
+}
 InfoSub::InfoSub(Source& source)
     : m_source(source)
     , mSeq(assign_id())
@@ -41,6 +83,18 @@ std::uint64_t InfoSub::getSeq ()
 {
     return mSeq;
 }
+void InfoSub::setBinary (bool binary)
+{
+    binary_ = binary;
+}
+bool InfoSub::isBinary () const
+{
+    return binary_;
+}
+void InfoSub::send (Message const& msg, bool broadcast)
+{
+    send (msg.json (isBinary ()), broadcast);
+}
 void InfoSub::onSendEmpty ()
 {
 }
@@ -817,6 +817,7 @@ public:
             {   "logrotate",            &RPCParser::parseAsIs,                  0,  0   },
             {   "owner_info",           &RPCParser::parseAccountItems,          1,  2   },
             {   "peers",                &RPCParser::parseAsIs,                  0,  0   },
+            {   "perf_histograms",      &RPCParser::parseAsIs,                  0,  0   },
             {   "ping",                 &RPCParser::parseAsIs,                  0,  0   },
             {   "print",                &RPCParser::parseAsIs,                  0,  1   },
             {   "random",               &RPCParser::parseAsIs,                  0,  0   },
@@ -43,6 +43,7 @@ public:
             " path='" << mPath << "'";
     }
     ~RPCSubImp() = default;
+    using InfoSub::send;
     void send (Json::Value const& jvObj, bool broadcast) override
     {
         ScopedLockType sl (mLock);
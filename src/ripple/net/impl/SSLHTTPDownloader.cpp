@@ -2,6 +2,7 @@
 #include <ripple/net/SSLHTTPDownloader.h>
 #include <ripple/net/RegisterSSLCerts.h>
 #include <boost/asio/ssl.hpp>
+#include <vector>
 namespace ripple {
 SSLHTTPDownloader::SSLHTTPDownloader(
     boost::asio::io_service& io_service,
@@ -66,32 +67,81 @@ SSLHTTPDownloader::download(
             "exception: " << e.what();
         return false;
     }
-    if (!strand_.running_in_this_thread())
-        strand_.post(
-            std::bind(
-                &SSLHTTPDownloader::download,
-                this->shared_from_this(),
-                host,
-                port,
-                target,
-                version,
-                dstPath,
-                complete));
-    else
-        boost::asio::spawn(
-            strand_,
-            std::bind(
-                &SSLHTTPDownloader::do_session,
-                this->shared_from_this(),
-                host,
-                port,
-                target,
-                version,
-                dstPath,
-                complete,
-                std::placeholders::_1));
+    strand_.dispatch(
+        std::bind(
+            &SSLHTTPDownloader::spawn,
+            this->shared_from_this(),
+            host,
+            port,
+            target,
+            version,
+            dstPath,
+            Writer {},
+            complete));
     return true;
 }
+bool
+SSLHTTPDownloader::stream(
+    std::string const& host,
+    std::string const& port,
+    std::string const& target,
+    int version,
+    boost::filesystem::path const& dstDir,
+    Writer writer,
+    std::function<void(boost::filesystem::path)> complete)
+{
+    try
+    {
+        if (!is_directory(dstDir))
+        {
+            JLOG(j_.error()) <<
+                "Destination directory does not exist";
+            return false;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.error()) <<
+            "exception: " << e.what();
+        return false;
+    }
+    strand_.dispatch(
+        std::bind(
+            &SSLHTTPDownloader::spawn,
+            this->shared_from_this(),
+            host,
+            port,
+            target,
+            version,
+            dstDir,
+            std::move(writer),
+            complete));
+    return true;
+}
+void
+SSLHTTPDownloader::spawn(
+    std::string const& host,
+    std::string const& port,
+    std::string const& target,
+    int version,
+    boost::filesystem::path const& dstPath,
+    Writer const& writer,
+    std::function<void(boost::filesystem::path)> const& complete)
+{
+    boost::asio::spawn(
+        strand_,
+        std::bind(
+            &SSLHTTPDownloader::do_session,
+            this->shared_from_this(),
+            host,
+            port,
+            target,
+            version,
+            dstPath,
+            writer,
+            complete,
+            std::placeholders::_1));
+}
 void
 SSLHTTPDownloader::do_session(
     std::string const host,
@@ -99,12 +149,16 @@ SSLHTTPDownloader::do_session(
     std::string const target,
     int version,
     boost::filesystem::path dstPath,
+    Writer writer,
     std::function<void(boost::filesystem::path)> complete,
     boost::asio::yield_context yield)
 {
     using namespace boost::asio;
     using namespace boost::beast;
     boost::system::error_code ec;
+    auto const spacePath {writer ? dstPath : dstPath.parent_path()};
+    if (writer)
+        dstPath.clear();
     ip::tcp::resolver resolver {strand_.context()};
     auto const results = resolver.async_resolve(host, port, yield[ec]);
     if (ec)
@@ -166,7 +220,7 @@ SSLHTTPDownloader::do_session(
         {
             try
             {
-                if (*len > space(dstPath.parent_path()).available)
+                if (*len > space(spacePath).available)
                 {
                     return fail(dstPath, complete, ec,
                         "Insufficient disk space for download");
@@ -183,24 +237,59 @@ SSLHTTPDownloader::do_session(
     http::async_write(*stream_, req, yield[ec]);
     if(ec)
         return fail(dstPath, complete, ec, "async_write");
-    http::response_parser<http::file_body> p;
-    p.body_limit(std::numeric_limits<std::uint64_t>::max());
-    p.get().body().open(
-        dstPath.string().c_str(),
-        boost::beast::file_mode::write,
-        ec);
-    if (ec)
+    if (writer)
     {
-        p.get().body().close();
-        return fail(dstPath, complete, ec, "open");
+        http::response_parser<http::buffer_body> p;
+        p.body_limit(std::numeric_limits<std::uint64_t>::max());
+        http::async_read_header(*stream_, read_buf_, p, yield[ec]);
+        if (ec)
+            return fail(dstPath, complete, ec, "async_read_header");
+        std::vector<char> buf(64 * 1024);
+        while (!p.is_done())
+        {
+            p.get().body().data = buf.data();
+            p.get().body().size = buf.size();
+            http::async_read(*stream_, read_buf_, p, yield[ec]);
+            if (ec == http::error::need_buffer)
+                ec.assign(0, ec.category());
+            if (ec)
+                return fail(dstPath, complete, ec, "async_read");
+            auto const size {buf.size() - p.get().body().size};
+            if (size == 0)
+                continue;
+            try
+            {
+                writer(buf.data(), size);
+            }
+            catch (std::exception const& e)
+            {
+                return fail(dstPath, complete, ec,
+                    std::string("exception: ") + e.what());
+            }
+        }
+        dstPath = spacePath;
     }
-    http::async_read(*stream_, read_buf_, p, yield[ec]);
-    if (ec)
+    else
     {
+        http::response_parser<http::file_body> p;
+        p.body_limit(std::numeric_limits<std::uint64_t>::max());
+        p.get().body().open(
+            dstPath.string().c_str(),
+            boost::beast::file_mode::write,
+            ec);
+        if (ec)
+        {
+            p.get().body().close();
+            return fail(dstPath, complete, ec, "open");
+        }
+        http::async_read(*stream_, read_buf_, p, yield[ec]);
+        if (ec)
+        {
+            p.get().body().close();
+            return fail(dstPath, complete, ec, "async_read");
+        }
         p.get().body().close();
-        return fail(dstPath, complete, ec, "async_read");
     }
-    p.get().body().close();
     stream_->async_shutdown(yield[ec]);
     if (ec == boost::asio::error::eof)
         ec.assign(0, ec.category());
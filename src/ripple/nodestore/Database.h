@@ -1,17 +1,21 @@
 #ifndef RIPPLE_NODESTORE_DATABASE_H_INCLUDED
 #define RIPPLE_NODESTORE_DATABASE_H_INCLUDED
-#include <ripple/basics/TaggedCache.h>
+#include <ripple/basics/PartitionedTaggedCache.h>
 #include <ripple/basics/KeyCache.h>
+#include <ripple/json/json_value.h>
 #include <ripple/core/Stoppable.h>
 #include <ripple/nodestore/Backend.h>
 #include <ripple/nodestore/impl/Tuning.h>
 #include <ripple/nodestore/Scheduler.h>
 #include <ripple/nodestore/NodeObject.h>
 #include <ripple/protocol/SystemParameters.h>
+#include <array>
 #include <thread>
 namespace ripple {
 class Ledger;
 namespace NodeStore {
+using PCache = PartitionedTaggedCache<uint256, NodeObject>;
+using NCache = KeyCache<uint256>;
 class Database : public Stoppable
 {
 public:
@@ -37,14 +41,23 @@ public:
     std::shared_ptr<NodeObject>
     fetch(uint256 const& hash, std::uint32_t seq) = 0;
     virtual
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes, std::uint32_t seq);
+    virtual
     bool
     asyncFetch(uint256 const& hash, std::uint32_t seq,
-        std::shared_ptr<NodeObject>& object) = 0;
+        std::shared_ptr<NodeObject>& object, ReadPriority priority) = 0;
+    virtual
+    bool
+    canFetchBatch() const
+    {
+        return false;
+    }
     virtual
     bool
     copyLedger(std::shared_ptr<Ledger const> const& ledger) = 0;
     void
-    waitReads();
+    waitReads(ReadPriority priority);
     virtual
     int
     getDesiredAsyncReadCount(std::uint32_t seq) = 0;
@@ -67,6 +80,8 @@ public:
     getStoreSize() const { return storeSz_; }
     std::uint32_t
     getFetchSize() const { return fetchSz_; }
+    void
+    getCountsJson(Json::Value& obj);
     int
     fdlimit() const { return fdLimit_; }
     void
@@ -90,19 +105,27 @@ protected:
     }
     void
     asyncFetch(uint256 const& hash, std::uint32_t seq,
-        std::shared_ptr<TaggedCache<uint256, NodeObject>> const& pCache,
-            std::shared_ptr<KeyCache<uint256>> const& nCache);
+        std::shared_ptr<PCache> const& pCache,
+            std::shared_ptr<KeyCache<uint256>> const& nCache,
+                ReadPriority priority);
     std::shared_ptr<NodeObject>
     fetchInternal(uint256 const& hash, Backend& srcBackend);
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatchInternal(std::vector<uint256> const& hashes,
+        Backend& srcBackend);
     void
     importInternal(Backend& dstBackend, Database& srcDB);
     std::shared_ptr<NodeObject>
     doFetch(uint256 const& hash, std::uint32_t seq,
-        TaggedCache<uint256, NodeObject>& pCache,
+        PCache& pCache,
             KeyCache<uint256>& nCache, bool isAsync);
+    std::vector<std::shared_ptr<NodeObject>>
+    doFetchBatch(std::vector<uint256> const& hashes, std::uint32_t seq,
+        PCache& pCache,
+            KeyCache<uint256>& nCache);
     bool
     copyLedger(Backend& dstBackend, Ledger const& srcLedger,
-        std::shared_ptr<TaggedCache<uint256, NodeObject>> const& pCache,
+        std::shared_ptr<PCache> const& pCache,
             std::shared_ptr<KeyCache<uint256>> const& nCache,
                 std::shared_ptr<Ledger const> const& srcNext);
 private:
@@ -111,21 +134,38 @@ private:
     std::atomic<std::uint32_t> fetchHitCount_ {0};
     std::atomic<std::uint32_t> storeSz_ {0};
     std::atomic<std::uint32_t> fetchSz_ {0};
+    struct ReadRequest
+    {
+        std::uint32_t seq;
+        std::weak_ptr<PCache> pCache;
+        std::weak_ptr<KeyCache<uint256>> nCache;
+        std::chrono::steady_clock::time_point queued;
+    };
+    struct ReadQueue
+    {
+        std::map<uint256, ReadRequest> requests;
+        uint256 lastHash;
+        std::size_t limit {0};
+        std::uint64_t gen {0};
+        std::uint64_t served {0};
+        std::uint64_t coalesced {0};
+        std::uint64_t dropped {0};
+        std::array<std::uint64_t, readWaitBuckets> waits {};
+    };
     std::mutex readLock_;
     std::condition_variable readCondVar_;
     std::condition_variable readGenCondVar_;
-    std::map<uint256, std::tuple<std::uint32_t,
-        std::weak_ptr<TaggedCache<uint256, NodeObject>>,
-            std::weak_ptr<KeyCache<uint256>>>> read_;
-    uint256 readLastHash_;
+    std::array<ReadQueue, readPriorityCount> read_;
     std::vector<std::thread> readThreads_;
     bool readShut_ {false};
-    uint64_t readGen_ {0};
     std::uint32_t earliestSeq_ {XRP_LEDGER_EARLIEST_SEQ};
     virtual
     std::shared_ptr<NodeObject>
     fetchFrom(uint256 const& hash, std::uint32_t seq) = 0;
     virtual
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatchFrom(std::vector<uint256> const& hashes, std::uint32_t seq);
+    virtual
     void
     for_each(std::function <void(std::shared_ptr<NodeObject>)> f) = 0;
     void
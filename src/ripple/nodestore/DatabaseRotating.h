@@ -16,7 +16,7 @@ public:
         : Database(name, parent, scheduler, readThreads, config, journal)
     {}
     virtual
-    TaggedCache<uint256, NodeObject> const&
+    PCache const&
     getPositiveCache() = 0;
     virtual std::mutex& peekMutex() const = 0;
     virtual
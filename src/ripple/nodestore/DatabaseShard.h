@@ -56,6 +56,9 @@ public:
     void
     validate() = 0;
     virtual
+    Json::Value
+    getValidationProgress() = 0;
+    virtual
     std::uint32_t
     ledgersPerShard() const = 0;
     virtual
@@ -18,6 +18,12 @@ enum Status
     unknown,
     customCode = 100
 };
+enum class ReadPriority
+{
+    critical,
+    client,
+    history
+};
 using Batch = std::vector <std::shared_ptr<NodeObject>>;
 }
 }
@@ -229,13 +229,37 @@ public:
     bool
     canFetchBatch() override
     {
-        return false;
+        return true;
     }
     std::vector<std::shared_ptr<NodeObject>>
     fetchBatch (std::size_t n, void const* const* keys) override
     {
-        Throw<std::runtime_error> ("pure virtual called");
-        return {};
+        assert(m_db);
+        std::vector<rocksdb::Slice> slices;
+        slices.reserve (n);
+        for (std::size_t i = 0; i < n; ++i)
+            slices.emplace_back (static_cast <char const*> (keys[i]), m_keyBytes);
+        std::vector<std::string> values;
+        rocksdb::ReadOptions const options;
+        auto const statuses = m_db->MultiGet (options, slices, &values);
+        std::vector<std::shared_ptr<NodeObject>> results (n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (statuses[i].ok ())
+            {
+                DecodedBlob decoded (keys[i], values[i].data (), values[i].size ());
+                if (decoded.wasOk ())
+                    results[i] = decoded.createObject ();
+                else
+                    JLOG(m_journal.fatal()) <<
+                        "Corrupt NodeObject #" << uint256::fromVoid (keys[i]);
+            }
+            else if (! statuses[i].IsNotFound ())
+            {
+                JLOG(m_journal.error()) << statuses[i].ToString ();
+            }
+        }
+        return results;
     }
     void
     store (std::shared_ptr<NodeObject> const& object) override
@@ -4,8 +4,15 @@
 #include <ripple/basics/chrono.h>
 #include <ripple/beast/core/CurrentThreadName.h>
 #include <ripple/protocol/HashPrefix.h>
+#include <ripple/protocol/jss.h>
 namespace ripple {
 namespace NodeStore {
+static
+std::array<char const*, readPriorityCount> const readQueueNames {{
+    "critical", "client", "history"}};
+static
+std::array<std::size_t, readPriorityCount> const readQueueLimits {{
+    readQueueCriticalLimit, readQueueClientLimit, readQueueHistoryLimit}};
 Database::Database(
     std::string name,
     Stoppable& parent,
@@ -24,6 +31,12 @@ Database::Database(
             Throw<std::runtime_error>("Invalid earliest_seq");
         earliestSeq_ = seq;
     }
+    for (std::size_t i = 0; i < readPriorityCount; ++i)
+    {
+        read_[i].limit = readQueueLimits[i];
+        get_if_exists<std::size_t>(config,
+            std::string("read_queue_") + readQueueNames[i], read_[i].limit);
+    }
     while (readThreads-- > 0)
         readThreads_.emplace_back(&Database::threadEntry, this);
 }
@@ -32,14 +45,37 @@ Database::~Database()
     stopThreads();
 }
 void
-Database::waitReads()
+Database::waitReads(ReadPriority priority)
 {
     std::unique_lock<std::mutex> lock(readLock_);
-    std::uint64_t const wakeGen = readGen_ + 2;
-    while (! readShut_ && ! read_.empty() && (readGen_ < wakeGen))
+    auto const& queue = read_[static_cast<std::size_t>(priority)];
+    std::uint64_t const wakeGen = queue.gen + 2;
+    while (! readShut_ && ! queue.requests.empty() && (queue.gen < wakeGen))
         readGenCondVar_.wait(lock);
 }
 void
+Database::getCountsJson(Json::Value& obj)
+{
+    Json::Value& jv = (obj[jss::read_queue] = Json::objectValue);
+    std::lock_guard <std::mutex> lock(readLock_);
+    for (std::size_t i = 0; i < readPriorityCount; ++i)
+    {
+        auto const& queue = read_[i];
+        Json::Value& jq = (jv[readQueueNames[i]] = Json::objectValue);
+        jq[jss::depth] = static_cast<Json::UInt>(queue.requests.size());
+        jq[jss::limit] = static_cast<Json::UInt>(queue.limit);
+        jq[jss::served] = static_cast<Json::UInt>(queue.served);
+        jq[jss::coalesced] = static_cast<Json::UInt>(queue.coalesced);
+        jq[jss::dropped] = static_cast<Json::UInt>(queue.dropped);
+        Json::Value& jw = (jq[jss::wait_ms] = Json::objectValue);
+        for (std::size_t b = 0; b < readWaitBuckets; ++b)
+        {
+            jw[b + 1 < readWaitBuckets ? std::to_string(1 << b) : "inf"] =
+                static_cast<Json::UInt>(queue.waits[b]);
+        }
+    }
+}
+void
 Database::onStop()
 {
     stopThreads();
@@ -61,12 +97,36 @@ Database::stopThreads()
 }
 void
 Database::asyncFetch(uint256 const& hash, std::uint32_t seq,
-    std::shared_ptr<TaggedCache<uint256, NodeObject>> const& pCache,
-        std::shared_ptr<KeyCache<uint256>> const& nCache)
+    std::shared_ptr<PCache> const& pCache,
+        std::shared_ptr<KeyCache<uint256>> const& nCache,
+            ReadPriority priority)
 {
+    auto const index = static_cast<std::size_t>(priority);
     std::lock_guard <std::mutex> lock(readLock_);
-    if (read_.emplace(hash, std::make_tuple(seq, pCache, nCache)).second)
-        readCondVar_.notify_one();
+    auto& queue = read_[index];
+    for (std::size_t i = 0; i < readPriorityCount; ++i)
+    {
+        auto it = read_[i].requests.find(hash);
+        if (it == read_[i].requests.end())
+            continue;
+        ++queue.coalesced;
+        if (i > index && queue.requests.size() < queue.limit)
+        {
+            queue.requests.emplace(hash, std::move(it->second));
+            read_[i].requests.erase(it);
+            if (read_[i].requests.empty())
+                readGenCondVar_.notify_all();
+        }
+        return;
+    }
+    if (queue.requests.size() >= queue.limit)
+    {
+        ++queue.dropped;
+        return;
+    }
+    queue.requests.emplace(hash, ReadRequest{
+        seq, pCache, nCache, std::chrono::steady_clock::now()});
+    readCondVar_.notify_one();
 }
 std::shared_ptr<NodeObject>
 Database::fetchInternal(uint256 const& hash, Backend& srcBackend)
@@ -103,6 +163,43 @@ Database::fetchInternal(uint256 const& hash, Backend& srcBackend)
     }
     return nObj;
 }
+std::vector<std::shared_ptr<NodeObject>>
+Database::fetchBatchInternal(std::vector<uint256> const& hashes,
+    Backend& srcBackend)
+{
+    std::vector<std::shared_ptr<NodeObject>> nObjs;
+    if (! srcBackend.canFetchBatch())
+    {
+        nObjs.reserve(hashes.size());
+        for (auto const& hash : hashes)
+            nObjs.emplace_back(fetchInternal(hash, srcBackend));
+        return nObjs;
+    }
+    std::vector<void const*> keys;
+    keys.reserve(hashes.size());
+    for (auto const& hash : hashes)
+        keys.push_back(hash.begin());
+    try
+    {
+        nObjs = srcBackend.fetchBatch(keys.size(), keys.data());
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.fatal()) <<
+            "Exception, " << e.what();
+        Rethrow();
+    }
+    assert(nObjs.size() == hashes.size());
+    for (auto const& nObj : nObjs)
+    {
+        if (nObj)
+        {
+            ++fetchHitCount_;
+            fetchSz_ += nObj->getData().size();
+        }
+    }
+    return nObjs;
+}
 void
 Database::importInternal(Backend& dstBackend, Database& srcDB)
 {
@@ -129,7 +226,7 @@ Database::importInternal(Backend& dstBackend, Database& srcDB)
 }
 std::shared_ptr<NodeObject>
 Database::doFetch(uint256 const& hash, std::uint32_t seq,
-    TaggedCache<uint256, NodeObject>& pCache,
+    PCache& pCache,
         KeyCache<uint256>& nCache, bool isAsync)
 {
     FetchReport report;
@@ -162,9 +259,63 @@ Database::doFetch(uint256 const& hash, std::uint32_t seq,
     scheduler_.onFetch(report);
     return nObj;
 }
+std::vector<std::shared_ptr<NodeObject>>
+Database::doFetchBatch(std::vector<uint256> const& hashes, std::uint32_t seq,
+    PCache& pCache,
+        KeyCache<uint256>& nCache)
+{
+    FetchReport report;
+    report.isAsync = false;
+    report.wentToDisk = false;
+    using namespace std::chrono;
+    auto const before = steady_clock::now();
+    std::vector<std::shared_ptr<NodeObject>> nObjs(hashes.size());
+    std::vector<uint256> missed;
+    std::vector<std::size_t> missedIndex;
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        nObjs[i] = pCache.fetch(hashes[i]);
+        if (! nObjs[i] && ! nCache.touch_if_exists(hashes[i]))
+        {
+            missed.push_back(hashes[i]);
+            missedIndex.push_back(i);
+        }
+    }
+    report.wasFound = true;
+    if (! missed.empty())
+    {
+        report.wentToDisk = true;
+        auto fetched = fetchBatchFrom(missed, seq);
+        assert(fetched.size() == missed.size());
+        fetchTotalCount_ += missed.size();
+        for (std::size_t i = 0; i < missed.size(); ++i)
+        {
+            auto& nObj = nObjs[missedIndex[i]];
+            nObj = std::move(fetched[i]);
+            if (! nObj)
+            {
+                nObj = pCache.fetch(missed[i]);
+                if (! nObj)
+                {
+                    nCache.insert(missed[i]);
+                    report.wasFound = false;
+                }
+            }
+            else
+                pCache.canonicalize(missed[i], nObj);
+        }
+        JLOG(j_.trace()) <<
+            "fetchBatch: " << hashes.size() << " requested, " <<
+            missed.size() << " from db";
+    }
+    report.elapsed = duration_cast<milliseconds>(
+        steady_clock::now() - before);
+    scheduler_.onFetch(report);
+    return nObjs;
+}
 bool
 Database::copyLedger(Backend& dstBackend, Ledger const& srcLedger,
-    std::shared_ptr<TaggedCache<uint256, NodeObject>> const& pCache,
+    std::shared_ptr<PCache> const& pCache,
         std::shared_ptr<KeyCache<uint256>> const& nCache,
             std::shared_ptr<Ledger const> const& srcNext)
 {
@@ -273,6 +424,24 @@ Database::copyLedger(Backend& dstBackend, Ledger const& srcLedger,
         storeBatch();
     return true;
 }
+std::vector<std::shared_ptr<NodeObject>>
+Database::fetchBatch(std::vector<uint256> const& hashes, std::uint32_t seq)
+{
+    std::vector<std::shared_ptr<NodeObject>> nObjs;
+    nObjs.reserve(hashes.size());
+    for (auto const& hash : hashes)
+        nObjs.emplace_back(fetch(hash, seq));
+    return nObjs;
+}
+std::vector<std::shared_ptr<NodeObject>>
+Database::fetchBatchFrom(std::vector<uint256> const& hashes, std::uint32_t seq)
+{
+    std::vector<std::shared_ptr<NodeObject>> nObjs;
+    nObjs.reserve(hashes.size());
+    for (auto const& hash : hashes)
+        nObjs.emplace_back(fetchFrom(hash, seq));
+    return nObjs;
+}
 void
 Database::threadEntry()
 {
@@ -280,34 +449,50 @@ Database::threadEntry()
     while (true)
     {
         uint256 lastHash;
-        std::uint32_t lastSeq;
-        std::shared_ptr<TaggedCache<uint256, NodeObject>> lastPcache;
-        std::shared_ptr<KeyCache<uint256>> lastNcache;
+        ReadRequest request;
         {
             std::unique_lock<std::mutex> lock(readLock_);
-            while (! readShut_ && read_.empty())
+            auto next = [this]()
+            {
+                for (auto& queue : read_)
+                    if (! queue.requests.empty())
+                        return &queue;
+                return static_cast<ReadQueue*>(nullptr);
+            };
+            ReadQueue* queue;
+            while (! readShut_ && ! (queue = next()))
             {
                 readGenCondVar_.notify_all();
                 readCondVar_.wait(lock);
             }
             if (readShut_)
                 break;
-            auto it = read_.lower_bound(readLastHash_);
-            if (it == read_.end())
+            auto it = queue->requests.lower_bound(queue->lastHash);
+            if (it == queue->requests.end())
             {
-                it = read_.begin();
-                ++readGen_;
+                it = queue->requests.begin();
+                ++queue->gen;
                 readGenCondVar_.notify_all();
             }
             lastHash = it->first;
-            lastSeq = std::get<0>(it->second);
-            lastPcache = std::get<1>(it->second).lock();
-            lastNcache = std::get<2>(it->second).lock();
-            read_.erase(it);
-            readLastHash_ = lastHash;
+            request = std::move(it->second);
+            queue->requests.erase(it);
+            queue->lastHash = lastHash;
+            if (queue->requests.empty())
+                readGenCondVar_.notify_all();
+            using namespace std::chrono;
+            auto const waited = duration_cast<milliseconds>(
+                steady_clock::now() - request.queued).count();
+            std::size_t bucket = 0;
+            while (bucket + 1 < readWaitBuckets && waited >= (1 << bucket))
+                ++bucket;
+            ++queue->waits[bucket];
+            ++queue->served;
         }
-        if (lastPcache && lastPcache)
-            doFetch(lastHash, lastSeq, *lastPcache, *lastNcache, true);
+        auto const pCache = request.pCache.lock();
+        auto const nCache = request.nCache.lock();
+        if (pCache && nCache)
+            doFetch(lastHash, request.seq, *pCache, *nCache, true);
     }
 }
 } 
@@ -19,12 +19,13 @@ DatabaseNodeImp::store(NodeObjectType type, Blob&& data,
 }
 bool
 DatabaseNodeImp::asyncFetch(uint256 const& hash,
-    std::uint32_t seq, std::shared_ptr<NodeObject>& object)
+    std::uint32_t seq, std::shared_ptr<NodeObject>& object,
+        ReadPriority priority)
 {
     object = pCache_->fetch(hash);
     if (object || nCache_->touch_if_exists(hash))
         return true;
-    Database::asyncFetch(hash, seq, pCache_, nCache_);
+    Database::asyncFetch(hash, seq, pCache_, nCache_, priority);
     return false;
 }
 void
@@ -19,7 +19,7 @@ public:
         Section const& config,
         beast::Journal j)
         : Database(name, parent, scheduler, readThreads, config, j)
-        , pCache_(std::make_shared<TaggedCache<uint256, NodeObject>>(
+        , pCache_(std::make_shared<PCache>(
             name, cacheTargetSize, cacheTargetAge, stopwatch(), j))
         , nCache_(std::make_shared<KeyCache<uint256>>(
             name, stopwatch(), cacheTargetSize, cacheTargetAge))
@@ -54,9 +54,20 @@ public:
     {
         return doFetch(hash, seq, *pCache_, *nCache_, false);
     }
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes,
+        std::uint32_t seq) override
+    {
+        return doFetchBatch(hashes, seq, *pCache_, *nCache_);
+    }
     bool
     asyncFetch(uint256 const& hash, std::uint32_t seq,
-        std::shared_ptr<NodeObject>& object) override;
+        std::shared_ptr<NodeObject>& object, ReadPriority priority) override;
+    bool
+    canFetchBatch() const override
+    {
+        return backend_->canFetchBatch();
+    }
     bool
     copyLedger(std::shared_ptr<Ledger const> const& ledger) override
     {
@@ -75,7 +86,7 @@ public:
     void
     sweep() override;
 private:
-    std::shared_ptr<TaggedCache<uint256, NodeObject>> pCache_;
+    std::shared_ptr<PCache> pCache_;
     std::shared_ptr<KeyCache<uint256>> nCache_;
     std::unique_ptr<Backend> backend_;
     std::shared_ptr<NodeObject>
@@ -83,6 +94,12 @@ private:
     {
         return fetchInternal(hash, *backend_);
     }
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatchFrom(std::vector<uint256> const& hashes,
+        std::uint32_t seq) override
+    {
+        return fetchBatchInternal(hashes, *backend_);
+    }
     void
     for_each(std::function<void(std::shared_ptr<NodeObject>)> f) override
     {
@@ -14,7 +14,7 @@ DatabaseRotatingImp::DatabaseRotatingImp(
     Section const& config,
     beast::Journal j)
     : DatabaseRotating(name, parent, scheduler, readThreads, config, j)
-    , pCache_(std::make_shared<TaggedCache<uint256, NodeObject>>(
+    , pCache_(std::make_shared<PCache>(
         name, cacheTargetSize, cacheTargetAge, stopwatch(), j))
     , nCache_(std::make_shared<KeyCache<uint256>>(
         name, stopwatch(), cacheTargetSize, cacheTargetAge))
@@ -50,12 +50,13 @@ DatabaseRotatingImp::store(NodeObjectType type, Blob&& data,
 }
 bool
 DatabaseRotatingImp::asyncFetch(uint256 const& hash,
-    std::uint32_t seq, std::shared_ptr<NodeObject>& object)
+    std::uint32_t seq, std::shared_ptr<NodeObject>& object,
+        ReadPriority priority)
 {
     object = pCache_->fetch(hash);
     if (object || nCache_->touch_if_exists(hash))
         return true;
-    Database::asyncFetch(hash, seq, pCache_, nCache_);
+    Database::asyncFetch(hash, seq, pCache_, nCache_, priority);
     return false;
 }
 void
@@ -88,5 +89,41 @@ DatabaseRotatingImp::fetchFrom(uint256 const& hash, std::uint32_t seq)
     }
     return nObj;
 }
+std::vector<std::shared_ptr<NodeObject>>
+DatabaseRotatingImp::fetchBatchFrom(
+    std::vector<uint256> const& hashes, std::uint32_t seq)
+{
+    Backends b = getBackends();
+    auto nObjs = fetchBatchInternal(hashes, *b.writableBackend);
+    std::vector<uint256> missed;
+    std::vector<std::size_t> missedIndex;
+    for (std::size_t i = 0; i < nObjs.size(); ++i)
+    {
+        if (! nObjs[i])
+        {
+            missed.push_back(hashes[i]);
+            missedIndex.push_back(i);
+        }
+    }
+    if (missed.empty())
+        return nObjs;
+    auto archived = fetchBatchInternal(missed, *b.archiveBackend);
+    Batch batch;
+    batch.reserve(archived.size());
+    for (std::size_t i = 0; i < archived.size(); ++i)
+    {
+        if (archived[i])
+        {
+            batch.push_back(archived[i]);
+            nObjs[missedIndex[i]] = std::move(archived[i]);
+        }
+    }
+    if (batch.empty())
+        return nObjs;
+    getWritableBackend()->storeBatch(batch);
+    for (auto const& nObj : batch)
+        nCache_->erase(nObj->getHash());
+    return nObjs;
+}
 } 
 } 
@@ -53,9 +53,22 @@ public:
     {
         return doFetch(hash, seq, *pCache_, *nCache_, false);
     }
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes,
+        std::uint32_t seq) override
+    {
+        return doFetchBatch(hashes, seq, *pCache_, *nCache_);
+    }
     bool
     asyncFetch(uint256 const& hash, std::uint32_t seq,
-        std::shared_ptr<NodeObject>& object) override;
+        std::shared_ptr<NodeObject>& object, ReadPriority priority) override;
+    bool
+    canFetchBatch() const override
+    {
+        Backends b = getBackends();
+        return b.writableBackend->canFetchBatch() &&
+            b.archiveBackend->canFetchBatch();
+    }
     bool
     copyLedger(std::shared_ptr<Ledger const> const& ledger) override
     {
@@ -73,10 +86,10 @@ public:
     tune(int size, std::chrono::seconds age) override;
     void
     sweep() override;
-    TaggedCache<uint256, NodeObject> const&
+    PCache const&
     getPositiveCache() override {return *pCache_;}
 private:
-    std::shared_ptr<TaggedCache<uint256, NodeObject>> pCache_;
+    std::shared_ptr<PCache> pCache_;
     std::shared_ptr<KeyCache<uint256>> nCache_;
     std::unique_ptr<Backend> writableBackend_;
     std::unique_ptr<Backend> archiveBackend_;
@@ -92,6 +105,8 @@ private:
     }
     std::shared_ptr<NodeObject> fetchFrom(
         uint256 const& hash, std::uint32_t seq) override;
+    std::vector<std::shared_ptr<NodeObject>> fetchBatchFrom(
+        std::vector<uint256> const& hashes, std::uint32_t seq) override;
     void
     for_each(std::function <void(std::shared_ptr<NodeObject>)> f) override
     {
@@ -9,6 +9,7 @@
 #include <ripple/overlay/Overlay.h>
 #include <ripple/overlay/predicates.h>
 #include <ripple/protocol/HashPrefix.h>
+#include <ripple/protocol/jss.h>
 namespace ripple {
 namespace NodeStore {
 constexpr std::uint32_t DatabaseShard::ledgersPerShardDefault;
@@ -32,6 +33,8 @@ DatabaseShardImp::DatabaseShardImp(
         config, "ledgers_per_shard", ledgersPerShardDefault))
     , earliestShardIndex_(seqToShardIndex(earliestSeq()))
     , avgShardSz_(ledgersPerShard_ * (192 * 1024))
+    , validateThreads_(std::max<std::uint32_t>(1, std::min<std::uint32_t>(
+        get<std::uint32_t>(config, "validate_threads", 4), 32)))
 {
     ctx_->start();
 }
@@ -40,6 +43,7 @@ DatabaseShardImp::~DatabaseShardImp()
     stopThreads();
     std::lock_guard<std::mutex> lock(m_);
     complete_.clear();
+    publishComplete();
     if (incomplete_)
         incomplete_.reset();
     preShards_.clear();
@@ -147,6 +151,7 @@ DatabaseShardImp::init()
             "exception: " << e.what();
         return false;
     }
+    publishComplete();
     if (!incomplete_ && complete_.empty())
     {
         if (maxDiskSpace_ > available())
@@ -377,7 +382,7 @@ DatabaseShardImp::importShard(std::uint32_t shardIndex,
     {
         it->second = shard.get();
         lock.unlock();
-        auto const valid {shard->validate(app_)};
+        auto const valid {shard->validate(app_, validateThreads_)};
         lock.lock();
         if (!valid)
         {
@@ -389,6 +394,7 @@ DatabaseShardImp::importShard(std::uint32_t shardIndex,
     }
     usedDiskSpace_ += shard->fileSize();
     complete_.emplace(shardIndex, std::move(shard));
+    publishComplete();
     preShards_.erase(shardIndex);
     return true;
 }
@@ -469,6 +475,7 @@ DatabaseShardImp::setStored(std::shared_ptr<Ledger const> const& ledger)
     {
         complete_.emplace(incomplete_->index(), std::move(incomplete_));
         incomplete_.reset();
+        publishComplete();
         updateStats(lock);
         protocol::TMPeerShardInfo message;
         PublicKey const& publicKey {app_.nodeIdentity().first};
@@ -482,6 +489,8 @@ bool
 DatabaseShardImp::contains(std::uint32_t seq)
 {
     auto const shardIndex {seqToShardIndex(seq)};
+    if (findComplete(shardIndex))
+        return true;
     std::lock_guard<std::mutex> lock(m_);
     assert(init_);
     if (complete_.find(shardIndex) != complete_.end())
@@ -497,6 +506,22 @@ DatabaseShardImp::getCompleteShards()
     assert(init_);
     return status_;
 }
+Json::Value
+DatabaseShardImp::getValidationProgress()
+{
+    Json::Value ret {Json::arrayValue};
+    std::lock_guard<std::mutex> lock(m_);
+    for (auto const& e : preShards_)
+    {
+        if (!e.second)
+            continue;
+        Json::Value& progress {ret.append(Json::objectValue)};
+        progress[jss::index] = e.first;
+        progress[jss::validated] = e.second->validated();
+        progress[jss::total] = e.second->maxLedgers();
+    }
+    return ret;
+}
 void
 DatabaseShardImp::validate()
 {
@@ -521,12 +546,12 @@ DatabaseShardImp::validate()
     for (auto& e : complete_)
     {
         app_.shardFamily()->reset();
-        e.second->validate(app_);
+        e.second->validate(app_, validateThreads_);
     }
     if (incomplete_)
     {
         app_.shardFamily()->reset();
-        incomplete_->validate(app_);
+        incomplete_->validate(app_, validateThreads_);
     }
     app_.shardFamily()->reset();
 }
@@ -687,6 +712,7 @@ DatabaseShardImp::import(Database& source)
     }
     init_ = false;
     complete_.clear();
+    publishComplete();
     incomplete_.reset();
     usedDiskSpace_ = 0;
     lock.unlock();
@@ -742,9 +768,19 @@ DatabaseShardImp::fetch(uint256 const& hash, std::uint32_t seq)
         return doFetch(hash, seq, *cache.first, *cache.second, false);
     return {};
 }
+std::vector<std::shared_ptr<NodeObject>>
+DatabaseShardImp::fetchBatch(
+    std::vector<uint256> const& hashes, std::uint32_t seq)
+{
+    auto cache {selectCache(seq)};
+    if (cache.first)
+        return doFetchBatch(hashes, seq, *cache.first, *cache.second);
+    return std::vector<std::shared_ptr<NodeObject>>(hashes.size());
+}
 bool
 DatabaseShardImp::asyncFetch(uint256 const& hash,
-    std::uint32_t seq, std::shared_ptr<NodeObject>& object)
+    std::uint32_t seq, std::shared_ptr<NodeObject>& object,
+        ReadPriority priority)
 {
     auto cache {selectCache(seq)};
     if (cache.first)
@@ -752,11 +788,21 @@ DatabaseShardImp::asyncFetch(uint256 const& hash,
         object = cache.first->fetch(hash);
         if (object || cache.second->touch_if_exists(hash))
             return true;
-        Database::asyncFetch(hash, seq, cache.first, cache.second);
+        Database::asyncFetch(hash, seq, cache.first, cache.second, priority);
     }
     return false;
 }
 bool
+DatabaseShardImp::canFetchBatch() const
+{
+    std::lock_guard<std::mutex> lock(m_);
+    if (incomplete_)
+        return incomplete_->getBackend()->canFetchBatch();
+    if (!complete_.empty())
+        return complete_.begin()->second->getBackend()->canFetchBatch();
+    return false;
+}
+bool
 DatabaseShardImp::copyLedger(std::shared_ptr<Ledger const> const& ledger)
 {
     auto const shardIndex {seqToShardIndex(ledger->info().seq)};
@@ -787,6 +833,7 @@ DatabaseShardImp::copyLedger(std::shared_ptr<Ledger const> const& ledger)
     {
         complete_.emplace(incomplete_->index(), std::move(incomplete_));
         incomplete_.reset();
+        publishComplete();
         updateStats(lock);
     }
     return true;
@@ -795,6 +842,8 @@ int
 DatabaseShardImp::getDesiredAsyncReadCount(std::uint32_t seq)
 {
     auto const shardIndex {seqToShardIndex(seq)};
+    if (auto const shard = findComplete(shardIndex))
+        return shard->pCache()->getTargetSize() / asyncDivider;
     {
         std::lock_guard<std::mutex> lock(m_);
         assert(init_);
@@ -871,30 +920,18 @@ DatabaseShardImp::sweep()
 std::shared_ptr<NodeObject>
 DatabaseShardImp::fetchFrom(uint256 const& hash, std::uint32_t seq)
 {
-    auto const shardIndex {seqToShardIndex(seq)};
-    std::unique_lock<std::mutex> lock(m_);
-    assert(init_);
-    {
-        auto it = complete_.find(shardIndex);
-        if (it != complete_.end())
-        {
-            lock.unlock();
-            return fetchInternal(hash, *it->second->getBackend());
-        }
-    }
-    if (incomplete_ && incomplete_->index() == shardIndex)
-    {
-        lock.unlock();
-        return fetchInternal(hash, *incomplete_->getBackend());
-    }
-    auto it = preShards_.find(shardIndex);
-    if (it != preShards_.end() && it->second)
-    {
-        lock.unlock();
-        return fetchInternal(hash, *it->second->getBackend());
-    }
+    if (auto const backend = findBackend(seqToShardIndex(seq)))
+        return fetchInternal(hash, *backend);
     return {};
 }
+std::vector<std::shared_ptr<NodeObject>>
+DatabaseShardImp::fetchBatchFrom(
+    std::vector<uint256> const& hashes, std::uint32_t seq)
+{
+    if (auto const backend = findBackend(seqToShardIndex(seq)))
+        return fetchBatchInternal(hashes, *backend);
+    return std::vector<std::shared_ptr<NodeObject>>(hashes.size());
+}
 boost::optional<std::uint32_t>
 DatabaseShardImp::findShardIndexToAdd(
     std::uint32_t validLedgerSeq, std::lock_guard<std::mutex>&)
@@ -993,6 +1030,8 @@ std::pair<std::shared_ptr<PCache>, std::shared_ptr<NCache>>
 DatabaseShardImp::selectCache(std::uint32_t seq)
 {
     auto const shardIndex {seqToShardIndex(seq)};
+    if (auto const shard = findComplete(shardIndex))
+        return std::make_pair(shard->pCache(), shard->nCache());
     std::lock_guard<std::mutex> lock(m_);
     assert(init_);
     {
@@ -1016,6 +1055,49 @@ DatabaseShardImp::selectCache(std::uint32_t seq)
     }
     return {};
 }
+void
+DatabaseShardImp::publishComplete()
+{
+    auto index {std::make_shared<ShardIndex>()};
+    if (!complete_.empty())
+    {
+        index->resize(complete_.rbegin()->first - earliestShardIndex_ + 1);
+        for (auto const& c : complete_)
+            (*index)[c.first - earliestShardIndex_] = c.second;
+    }
+    std::atomic_store(&completeIndex_,
+        std::shared_ptr<ShardIndex const>(std::move(index)));
+}
+std::shared_ptr<Shard>
+DatabaseShardImp::findComplete(std::uint32_t shardIndex) const
+{
+    auto const index {std::atomic_load(&completeIndex_)};
+    if (!index || shardIndex < earliestShardIndex_ ||
+        shardIndex - earliestShardIndex_ >= index->size())
+    {
+        return {};
+    }
+    return (*index)[shardIndex - earliestShardIndex_];
+}
+std::shared_ptr<Backend>
+DatabaseShardImp::findBackend(std::uint32_t shardIndex)
+{
+    if (auto const shard = findComplete(shardIndex))
+        return shard->getBackend();
+    std::lock_guard<std::mutex> lock(m_);
+    assert(init_);
+    {
+        auto it = complete_.find(shardIndex);
+        if (it != complete_.end())
+            return it->second->getBackend();
+    }
+    if (incomplete_ && incomplete_->index() == shardIndex)
+        return incomplete_->getBackend();
+    auto it = preShards_.find(shardIndex);
+    if (it != preShards_.end() && it->second)
+        return it->second->getBackend();
+    return {};
+}
 std::uint64_t
 DatabaseShardImp::available() const
 {
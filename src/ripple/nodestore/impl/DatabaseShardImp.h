@@ -44,6 +44,8 @@ public:
     getCompleteShards() override;
     void
     validate() override;
+    Json::Value
+    getValidationProgress() override;
     std::uint32_t
     ledgersPerShard() const override
     {
@@ -93,9 +95,14 @@ public:
         uint256 const& hash, std::uint32_t seq) override;
     std::shared_ptr<NodeObject>
     fetch(uint256 const& hash, std::uint32_t seq) override;
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes,
+        std::uint32_t seq) override;
     bool
     asyncFetch(uint256 const& hash, std::uint32_t seq,
-        std::shared_ptr<NodeObject>& object) override;
+        std::shared_ptr<NodeObject>& object, ReadPriority priority) override;
+    bool
+    canFetchBatch() const override;
     bool
     copyLedger(std::shared_ptr<Ledger const> const& ledger) override;
     int
@@ -111,8 +118,10 @@ private:
     mutable std::mutex m_;
     bool init_ {false};
     std::unique_ptr<nudb::context> ctx_;
-    std::map<std::uint32_t, std::unique_ptr<Shard>> complete_;
+    std::map<std::uint32_t, std::shared_ptr<Shard>> complete_;
     std::unique_ptr<Shard> incomplete_;
+    using ShardIndex = std::vector<std::shared_ptr<Shard>>;
+    std::shared_ptr<ShardIndex const> completeIndex_;
     std::map<std::uint32_t, Shard*> preShards_;
     Section const config_;
     boost::filesystem::path const dir_;
@@ -125,11 +134,15 @@ private:
     std::uint32_t const ledgersPerShard_;
     std::uint32_t const earliestShardIndex_;
     std::uint64_t avgShardSz_;
+    std::uint32_t const validateThreads_;
     int cacheSz_ {shardCacheSz};
     std::chrono::seconds cacheAge_ {shardCacheAge};
     static constexpr auto importMarker_ = "import";
     std::shared_ptr<NodeObject>
     fetchFrom(uint256 const& hash, std::uint32_t seq) override;
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatchFrom(std::vector<uint256> const& hashes,
+        std::uint32_t seq) override;
     void
     for_each(std::function <void(std::shared_ptr<NodeObject>)> f) override
     {
@@ -142,6 +155,12 @@ private:
     updateStats(std::lock_guard<std::mutex>&);
     std::pair<std::shared_ptr<PCache>, std::shared_ptr<NCache>>
     selectCache(std::uint32_t seq);
+    void
+    publishComplete();
+    std::shared_ptr<Shard>
+    findComplete(std::uint32_t shardIndex) const;
+    std::shared_ptr<Backend>
+    findBackend(std::uint32_t shardIndex);
     int
     calcTargetCacheSz(std::lock_guard<std::mutex>&) const
     {
@@ -3,7 +3,9 @@
 #include <ripple/app/ledger/InboundLedger.h>
 #include <ripple/nodestore/impl/DatabaseShardImp.h>
 #include <ripple/nodestore/Manager.h>
+#include <atomic>
 #include <fstream>
+#include <thread>
 namespace ripple {
 namespace NodeStore {
 Shard::Shard(DatabaseShard const& db, std::uint32_t index,
@@ -182,7 +184,7 @@ Shard::contains(std::uint32_t seq) const
     return boost::icl::contains(storedSeqs_, seq);
 }
 bool
-Shard::validate(Application& app)
+Shard::validate(Application& app, std::uint32_t threads)
 {
     uint256 hash;
     std::uint32_t seq;
@@ -230,13 +232,15 @@ Shard::validate(Application& app)
     auto const savedAge {pCache_->getTargetAge()};
     using namespace std::chrono_literals;
     pCache_->setTargetAge(1s);
-    std::shared_ptr<Ledger const> next;
+    validated_ = 0;
+    std::vector<LedgerInfo> infos;
+    infos.reserve(lastSeq_ - firstSeq_ + 1);
     while (seq >= firstSeq_)
     {
         auto nObj = valFetch(hash);
         if (!nObj)
             break;
-        l = std::make_shared<Ledger>(
+        auto const l = std::make_shared<Ledger>(
             InboundLedger::deserializeHeader(makeSlice(nObj->getData()),
                 true), app.config(), *app.shardFamily());
         if (l->info().hash != hash || l->info().seq != seq)
@@ -247,35 +251,70 @@ Shard::validate(Application& app)
                 " cannot be a ledger";
             break;
         }
-        l->stateMap().setLedgerSeq(seq);
-        l->txMap().setLedgerSeq(seq);
-        l->setImmutable(app.config());
-        if (!l->stateMap().fetchRoot(
-            SHAMapHash {l->info().accountHash}, nullptr))
-        {
-            JLOG(j_.error()) <<
-                "ledger seq " << seq <<
-                " missing Account State root";
-            break;
-        }
-        if (l->info().txHash.isNonZero())
+        infos.push_back(l->info());
+        hash = l->info().parentHash;
+        --seq;
+    }
+    std::atomic<std::size_t> nextChunk {0};
+    std::atomic<std::size_t> failed {infos.size()};
+    auto const chunks {(infos.size() + valChunkSize - 1) / valChunkSize};
+    auto work = [&]()
+    {
+        for (auto chunk = nextChunk++; chunk < chunks; chunk = nextChunk++)
         {
-            if (!l->txMap().fetchRoot(
-                SHAMapHash {l->info().txHash}, nullptr))
+            auto const first {chunk * valChunkSize};
+            auto const last {std::min(first + valChunkSize, infos.size())};
+            std::shared_ptr<Ledger const> next;
+            if (first > 0)
             {
-                JLOG(j_.error()) <<
-                    "ledger seq " << seq <<
-                    " missing TX root";
-                break;
+                try
+                {
+                    next = valLoad(app, infos[first - 1], false);
+                }
+                catch (std::exception const& e)
+                {
+                    JLOG(j_.error()) <<
+                        "exception: " << e.what();
+                }
+            }
+            for (auto i = first; i < last && i < failed; ++i)
+            {
+                std::shared_ptr<Ledger const> l;
+                try
+                {
+                    l = valLoad(app, infos[i], true);
+                    if (l && !valLedger(l, next))
+                        l.reset();
+                }
+                catch (std::exception const& e)
+                {
+                    JLOG(j_.error()) <<
+                        "exception: " << e.what();
+                    l.reset();
+                }
+                if (!l)
+                {
+                    auto f {failed.load()};
+                    while (i < f && !failed.compare_exchange_weak(f, i));
+                    break;
+                }
+                next = l;
+                ++validated_;
+                if (l->info().seq % 128 == 0)
+                    pCache_->sweep();
             }
         }
-        if (!valLedger(l, next))
-            break;
-        hash = l->info().parentHash;
-        --seq;
-        next = l;
-        if (seq % 128 == 0)
-            pCache_->sweep();
+    };
+    std::vector<std::thread> workers;
+    for (std::uint32_t i = 1; i < threads && i < chunks; ++i)
+        workers.emplace_back(work);
+    work();
+    for (auto& worker : workers)
+        worker.join();
+    if (failed < infos.size())
+    {
+        seq = infos[failed].seq;
+        hash = infos[failed].hash;
     }
     pCache_->reset();
     nCache_->reset();
@@ -294,6 +333,40 @@ Shard::validate(Application& app)
         " is complete.";
     return true;
 }
+std::shared_ptr<Ledger const>
+Shard::valLoad(Application& app, LedgerInfo const& info, bool report)
+{
+    auto l = std::make_shared<Ledger>(info, app.config(), *app.shardFamily());
+    l->stateMap().setLedgerSeq(info.seq);
+    l->txMap().setLedgerSeq(info.seq);
+    l->setImmutable(app.config());
+    if (!l->stateMap().fetchRoot(
+        SHAMapHash {l->info().accountHash}, nullptr))
+    {
+        if (report)
+        {
+            JLOG(j_.error()) <<
+                "ledger seq " << info.seq <<
+                " missing Account State root";
+        }
+        return {};
+    }
+    if (l->info().txHash.isNonZero())
+    {
+        if (!l->txMap().fetchRoot(
+            SHAMapHash {l->info().txHash}, nullptr))
+        {
+            if (report)
+            {
+                JLOG(j_.error()) <<
+                    "ledger seq " << info.seq <<
+                    " missing TX root";
+            }
+            return {};
+        }
+    }
+    return l;
+}
 bool
 Shard::valLedger(std::shared_ptr<Ledger const> const& l,
     std::shared_ptr<Ledger const> const& next)
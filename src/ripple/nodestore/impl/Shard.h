@@ -3,6 +3,7 @@
 #include <ripple/app/ledger/Ledger.h>
 #include <ripple/basics/BasicConfig.h>
 #include <ripple/basics/RangeSet.h>
+#include <ripple/nodestore/Database.h>
 #include <ripple/nodestore/NodeObject.h>
 #include <ripple/nodestore/Scheduler.h>
 #include <nudb/nudb.hpp>
@@ -10,6 +11,7 @@
 #include <boost/serialization/map.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <atomic>
 namespace ripple {
 namespace NodeStore {
 inline static
@@ -28,8 +30,6 @@ removeAll(boost::filesystem::path const& path, beast::Journal& j)
     }
     return true;
 }
-using PCache = TaggedCache<uint256, NodeObject>;
-using NCache = KeyCache<uint256>;
 class DatabaseShard;
 class Shard
 {
@@ -45,7 +45,7 @@ public:
     bool
     contains(std::uint32_t seq) const;
     bool
-    validate(Application& app);
+    validate(Application& app, std::uint32_t threads = 1);
     std::uint32_t
     index() const {return index_;}
     bool
@@ -70,6 +70,10 @@ public:
     }
     std::shared_ptr<Ledger const>
     lastStored() {return lastStored_;}
+    std::uint32_t
+    validated() const {return validated_;}
+    std::uint32_t
+    maxLedgers() const {return maxLedgers_;}
 private:
     friend class boost::serialization::access;
     template<class Archive>
@@ -78,6 +82,7 @@ private:
         ar & storedSeqs_;
     }
     static constexpr auto controlFileName = "control.txt";
+    static constexpr std::size_t valChunkSize = 256;
     std::uint32_t const index_;
     std::uint32_t const firstSeq_;
     std::uint32_t const lastSeq_;
@@ -92,6 +97,9 @@ private:
     bool complete_ {false};
     RangeSet<std::uint32_t> storedSeqs_;
     std::shared_ptr<Ledger const> lastStored_;
+    std::atomic<std::uint32_t> validated_ {0};
+    std::shared_ptr<Ledger const>
+    valLoad(Application& app, LedgerInfo const& info, bool report);
     bool
     valLedger(std::shared_ptr<Ledger const> const& l,
         std::shared_ptr<Ledger const> const& next);
@@ -6,6 +6,11 @@ enum
 {
     cacheTargetSize     = 16384
     ,asyncDivider = 8
+    ,readPriorityCount = 3
+    ,readWaitBuckets = 12
+    ,readQueueCriticalLimit = 65536
+    ,readQueueClientLimit = 8192
+    ,readQueueHistoryLimit = 16384
 };
 std::chrono::seconds constexpr cacheTargetAge = std::chrono::minutes{5};
 auto constexpr shardCacheSz = 16384;
@@ -459,6 +459,19 @@ OverlayImpl::onWrite (beast::PropertyStream::Map& stream)
             item["messages_out"] = std::to_string(i.messagesOut.load());
         }
     }
+    beast::PropertyStream::Set lanes ("send_lanes", stream);
+    for (auto const& i : m_traffic.getLaneCounts())
+    {
+        if (i)
+        {
+            beast::PropertyStream::Map item(lanes);
+            item["lane"] = i.name;
+            item["messages"] = std::to_string(i.messages.load());
+            item["avg_wait_us"] = std::to_string(
+                i.waitTotal.load() / i.messages.load());
+            item["max_wait_us"] = std::to_string(i.waitMax.load());
+        }
+    }
 }
 
 void
@@ -558,6 +571,13 @@ OverlayImpl::reportTraffic (
 {
     m_traffic.addCount (cat, isInbound, number);
 }
+void
+OverlayImpl::reportSendWait (
+    TrafficCount::lane lane,
+    std::chrono::microseconds wait)
+{
+    m_traffic.addLaneWait (lane, wait);
+}
 Json::Value
 OverlayImpl::crawlShards(bool pubKey, std::uint32_t hops)
 {
@@ -233,6 +233,10 @@ public:
         bool isInbound,
         int bytes);
     void
+    reportSendWait (
+        TrafficCount::lane lane,
+        std::chrono::microseconds wait);
+    void
     incJqTransOverflow() override
     {
         ++jqTransOverflow_;
@@ -8,6 +8,7 @@
 #include <ripple/app/misc/HashRouter.h>
 #include <ripple/app/misc/LoadFeeTrack.h>
 #include <ripple/app/misc/NetworkOPs.h>
+#include <ripple/app/misc/SignatureVerifier.h>
 #include <ripple/app/misc/Transaction.h>
 #include <ripple/app/misc/ValidatorList.h>
 #include <ripple/app/tx/apply.h>
@@ -20,6 +21,7 @@
 #include <ripple/overlay/Cluster.h>
 #include <ripple/overlay/predicates.h>
 #include <ripple/protocol/digest.h>
+#include <ripple/protocol/Feature.h>
 #include <boost/algorithm/clamp.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string.hpp>
@@ -163,16 +165,7 @@ PeerImp::send (Message::pointer const& m)
     send_queue_.push(m);
     if(sendq_size != 0)
         return;
-    boost::asio::async_write(
-        stream_,
-        boost::asio::buffer(send_queue_.front()->getBuffer()),
-        bind_executor(
-            strand_,
-            std::bind(
-                &PeerImp::onWriteMessage,
-                shared_from_this(),
-                std::placeholders::_1,
-                std::placeholders::_2)));
+    writeFront();
 }
 void
 PeerImp::charge (Resource::Charge const& fee)
@@ -713,18 +706,7 @@ PeerImp::onWriteMessage (error_code ec, std::size_t bytes_transferred)
     assert(! send_queue_.empty());
     send_queue_.pop();
     if (! send_queue_.empty())
-    {
-        return boost::asio::async_write(
-            stream_,
-            boost::asio::buffer(send_queue_.front()->getBuffer()),
-            bind_executor(
-                strand_,
-                std::bind(
-                    &PeerImp::onWriteMessage,
-                    shared_from_this(),
-                    std::placeholders::_1,
-                    std::placeholders::_2)));
-    }
+        return writeFront();
     if (gracefulClose_)
     {
         return stream_.async_shutdown(bind_executor(
@@ -735,6 +717,23 @@ PeerImp::onWriteMessage (error_code ec, std::size_t bytes_transferred)
                 std::placeholders::_1)));
     }
 }
+void
+PeerImp::writeFront ()
+{
+    auto const& m = send_queue_.front();
+    overlay_.reportSendWait (
+        send_queue_.frontLane(), send_queue_.frontWait());
+    boost::asio::async_write(
+        stream_,
+        boost::asio::buffer(m->getBuffer()),
+        bind_executor(
+            strand_,
+            std::bind(
+                &PeerImp::onWriteMessage,
+                shared_from_this(),
+                std::placeholders::_1,
+                std::placeholders::_2)));
+}
 PeerImp::error_code
 PeerImp::onMessageUnknown (std::uint16_t type)
 {
@@ -1200,6 +1199,21 @@ PeerImp::onMessage (std::shared_ptr <protocol::TMTransaction> const& m)
         {
             JLOG(p_journal_.trace()) << "No new transactions until synchronized";
         }
+        else if (checkSignature)
+        {
+            if (! app_.getSignatureVerifier ().verifyTransaction (stx,
+                app_.getLedgerMaster ().getValidatedRules ().enabled (
+                    featureMultiSign),
+                [weak = std::weak_ptr<PeerImp>(shared_from_this()),
+                flags, stx] (bool valid) {
+                    if (auto peer = weak.lock())
+                        peer->onTransactionSignature (valid, flags, stx);
+                }))
+            {
+                overlay_.incJqTransOverflow();
+                JLOG(p_journal_.info()) << "Signature queue is full";
+            }
+        }
         else
         {
             app_.getJobQueue ().addJob (
@@ -1342,12 +1356,37 @@ PeerImp::onMessage (std::shared_ptr <protocol::TMProposeSet> const& m)
             app_.timeKeeper().closeTime(),
             calcNodeID(app_.validatorManifests().getMasterKey(publicKey))});
     std::weak_ptr<PeerImp> weak = shared_from_this();
-    app_.getJobQueue ().addJob (
-        isTrusted ? jtPROPOSAL_t : jtPROPOSAL_ut, "recvPropose->checkPropose",
-        [weak, m, proposal] (Job& job) {
+    auto const queue = [weak, m, proposal, isTrusted] ()
+    {
+        auto peer = weak.lock();
+        if (! peer)
+            return;
+        peer->app_.getJobQueue ().addJob (
+            isTrusted ? jtPROPOSAL_t : jtPROPOSAL_ut,
+            "recvPropose->checkPropose",
+            [weak, m, proposal] (Job& job) {
+                if (auto peer = weak.lock())
+                    peer->checkPropose(job, m, proposal);
+            });
+    };
+    if (cluster())
+        return queue();
+    if (! proposal.checkSign (app_.getSignatureVerifier (), isTrusted,
+        [weak, queue] (bool valid)
+        {
+            if (valid)
+                return queue();
             if (auto peer = weak.lock())
-                peer->checkPropose(job, m, proposal);
-        });
+            {
+                JLOG(peer->p_journal_.warn()) <<
+                    "Proposal fails sig check";
+                peer->charge (Resource::feeInvalidSignature);
+            }
+        }))
+    {
+        JLOG(p_journal_.debug()) << "Proposal: Dropping " <<
+            (isTrusted ? "trusted" : "UNTRUSTED") << " (verifier busy)";
+    }
 }
 void
 PeerImp::onMessage (std::shared_ptr <protocol::TMStatusChange> const& m)
@@ -1633,14 +1672,44 @@ PeerImp::onMessage (std::shared_ptr <protocol::TMValidation> const& m)
             ! app_.getFeeTrack ().isLoadedLocal ())
         {
             std::weak_ptr<PeerImp> weak = shared_from_this();
-            app_.getJobQueue ().addJob (
-                isTrusted ? jtVALIDATION_t : jtVALIDATION_ut,
-                "recvValidation->checkValidation",
-                [weak, val, m] (Job&)
+            auto const queue = [weak, val, m, isTrusted] ()
+            {
+                auto peer = weak.lock();
+                if (! peer)
+                    return;
+                peer->app_.getJobQueue ().addJob (
+                    isTrusted ? jtVALIDATION_t : jtVALIDATION_ut,
+                    "recvValidation->checkValidation",
+                    [weak, val, m] (Job&)
+                    {
+                        if (auto peer = weak.lock())
+                            peer->checkValidation(val, m);
+                    });
+            };
+            if (cluster())
+                return queue();
+            if (! app_.getSignatureVerifier ().verifyDigest (
+                val->getSignerPublic (),
+                val->getSigningHash (),
+                makeSlice (val->getSignature ()),
+                val->getFlags () & vfFullyCanonicalSig,
+                isTrusted,
+                [weak, queue] (bool valid)
                 {
+                    if (valid)
+                        return queue();
                     if (auto peer = weak.lock())
-                        peer->checkValidation(val, m);
-                });
+                    {
+                        JLOG(peer->p_journal_.warn()) <<
+                            "Validation is invalid";
+                        peer->charge (Resource::feeInvalidRequest);
+                    }
+                }))
+            {
+                JLOG(p_journal_.debug()) << "Validation: Dropping " <<
+                    (isTrusted ? "trusted" : "UNTRUSTED") <<
+                        " (verifier busy)";
+            }
         }
         else
         {
@@ -1864,6 +1933,20 @@ PeerImp::checkTransaction (int flags,
     }
 }
 void
+PeerImp::onTransactionSignature (bool valid,
+    int flags, std::shared_ptr<STTx const> const& stx)
+{
+    if (! valid)
+    {
+        app_.getHashRouter().setFlags(stx->getTransactionID(), SF_BAD);
+        charge(Resource::feeInvalidSignature);
+        return;
+    }
+    forceValidity(app_.getHashRouter(),
+        stx->getTransactionID(), Validity::SigGoodOnly);
+    checkTransaction(flags, true, stx);
+}
+void
 PeerImp::checkPropose (Job& job,
     std::shared_ptr <protocol::TMProposeSet> const& packet,
         RCLCxPeerPos peerPos)
@@ -1873,13 +1956,6 @@ PeerImp::checkPropose (Job& job,
         "Checking " << (isTrusted ? "trusted" : "UNTRUSTED") << " proposal";
     assert (packet);
     protocol::TMProposeSet& set = *packet;
-    if (! cluster() && !peerPos.checkSign ())
-    {
-        JLOG(p_journal_.warn()) <<
-            "Proposal fails sig check";
-        charge (Resource::feeInvalidSignature);
-        return;
-    }
     if (isTrusted)
     {
         app_.getOPs ().processTrustedProposal (peerPos, packet);
@@ -1906,13 +1982,6 @@ PeerImp::checkValidation (STValidation::pointer val,
 {
     try
     {
-        if (! cluster() && !val->isValid())
-        {
-            JLOG(p_journal_.warn()) <<
-                "Validation is invalid";
-            charge (Resource::feeInvalidRequest);
-            return;
-        }
         if (app_.getOPs ().recvValidation(val, std::to_string(id())) ||
             cluster())
         {
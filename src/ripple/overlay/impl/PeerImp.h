@@ -6,6 +6,7 @@
 #include <ripple/beast/asio/waitable_timer.h>
 #include <ripple/beast/utility/WrappedSink.h>
 #include <ripple/overlay/impl/ProtocolMessage.h>
+#include <ripple/overlay/impl/SendQueue.h>
 #include <ripple/overlay/impl/OverlayImpl.h>
 #include <ripple/peerfinder/PeerfinderManager.h>
 #include <ripple/protocol/Protocol.h>
@@ -16,7 +17,6 @@
 #include <boost/optional.hpp>
 #include <cstdint>
 #include <deque>
-#include <queue>
 #include <shared_mutex>
 namespace ripple {
 class PeerImp
@@ -101,7 +101,7 @@ private:
     http_response_type response_;
     boost::beast::http::fields const& headers_;
     boost::beast::multi_buffer write_buffer_;
-    std::queue<Message::pointer> send_queue_;
+    SendQueue send_queue_;
     bool gracefulClose_ = false;
     int large_sendq_ = 0;
     int no_ping_ = 0;
@@ -250,6 +250,8 @@ private:
     onReadMessage (error_code ec, std::size_t bytes_transferred);
     void
     onWriteMessage (error_code ec, std::size_t bytes_transferred);
+    void
+    writeFront ();
 public:
     static
     error_code
@@ -304,6 +306,9 @@ private:
     checkTransaction (int flags, bool checkSignature,
         std::shared_ptr<STTx const> const& stx);
     void
+    onTransactionSignature (bool valid, int flags,
+        std::shared_ptr<STTx const> const& stx);
+    void
     checkPropose (Job& job,
         std::shared_ptr<protocol::TMProposeSet> const& packet,
             RCLCxPeerPos peerPos);
@@ -0,0 +1,138 @@
+#ifndef RIPPLE_OVERLAY_SENDQUEUE_H_INCLUDED
+#define RIPPLE_OVERLAY_SENDQUEUE_H_INCLUDED
+#include <ripple/basics/safe_cast.h>
+#include <ripple/overlay/Message.h>
+#include <ripple/overlay/impl/TrafficCount.h>
+#include <ripple/overlay/impl/Tuning.h>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <deque>
+namespace ripple {
+class SendQueue
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using lane = TrafficCount::lane;
+    static std::size_t constexpr lanes = safe_cast<std::size_t>(lane::count);
+    SendQueue ()
+    {
+        for (std::size_t i = 0; i < lanes; ++i)
+            budget_[i] = laneBudget (i);
+    }
+    void
+    push (Message::pointer const& m)
+    {
+        auto const type = Message::getType (m->getBuffer ());
+        auto& q = lanes_[safe_cast<std::size_t>(TrafficCount::laneOf (type))];
+        if (type == protocol::mtSTATUS_CHANGE)
+        {
+            auto const iter = std::find_if (q.begin (), q.end (),
+                [](Entry const& e)
+                {
+                    return Message::getType (e.message->getBuffer ()) ==
+                        protocol::mtSTATUS_CHANGE;
+                });
+            if (iter != q.end ())
+            {
+                q.erase (iter);
+                --queued_;
+            }
+        }
+        q.push_back ({m, clock_type::now ()});
+        ++queued_;
+    }
+    Message::pointer const&
+    front ()
+    {
+        if (! current_)
+            next ();
+        assert (current_);
+        return current_;
+    }
+    void
+    pop ()
+    {
+        if (! current_)
+            next ();
+        current_.reset ();
+    }
+    std::size_t
+    size () const
+    {
+        return queued_ + (current_ ? 1 : 0);
+    }
+    bool
+    empty () const
+    {
+        return size () == 0;
+    }
+    lane
+    frontLane () const
+    {
+        return currentLane_;
+    }
+    std::chrono::microseconds
+    frontWait () const
+    {
+        return currentWait_;
+    }
+private:
+    struct Entry
+    {
+        Message::pointer message;
+        clock_type::time_point queued;
+    };
+    static std::int64_t
+    laneBudget (std::size_t i)
+    {
+        switch (safe_cast<lane>(i))
+        {
+        case lane::consensus:
+            return Tuning::consensusLaneBytes;
+        case lane::transactions:
+            return Tuning::transactionLaneBytes;
+        case lane::ledger_data:
+            return Tuning::ledgerDataLaneBytes;
+        default:
+            return Tuning::discoveryLaneBytes;
+        }
+    }
+    void
+    next ()
+    {
+        if (queued_ == 0)
+            return;
+        for (;;)
+        {
+            for (std::size_t i = 0; i < lanes; ++i)
+            {
+                auto& q = lanes_[i];
+                if (q.empty () || budget_[i] <= 0)
+                    continue;
+                auto entry = std::move (q.front ());
+                q.pop_front ();
+                --queued_;
+                budget_[i] -= entry.message->getBuffer ().size ();
+                current_ = std::move (entry.message);
+                currentLane_ = safe_cast<lane>(i);
+                currentWait_ = std::chrono::duration_cast<
+                    std::chrono::microseconds>(
+                        clock_type::now () - entry.queued);
+                return;
+            }
+            for (std::size_t i = 0; i < lanes; ++i)
+                budget_[i] = std::min (budget_[i], std::int64_t{0}) +
+                    laneBudget (i);
+        }
+    }
+    std::array<std::deque<Entry>, lanes> lanes_;
+    std::array<std::int64_t, lanes> budget_;
+    std::size_t queued_ = 0;
+    Message::pointer current_;
+    lane currentLane_ = lane::consensus;
+    std::chrono::microseconds currentWait_ {0};
+};
+}
+#endif
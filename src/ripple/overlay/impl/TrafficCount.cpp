@@ -100,4 +100,26 @@ TrafficCount::category TrafficCount::categorize (
     }
     return TrafficCount::category::unknown;
 }
+TrafficCount::lane TrafficCount::laneOf (int type)
+{
+    switch (type)
+    {
+    case protocol::mtTRANSACTION:
+        return lane::transactions;
+    case protocol::mtGET_LEDGER:
+    case protocol::mtLEDGER_DATA:
+    case protocol::mtGET_OBJECTS:
+    case protocol::mtGET_SHARD_INFO:
+    case protocol::mtSHARD_INFO:
+    case protocol::mtGET_PEER_SHARD_INFO:
+    case protocol::mtPEER_SHARD_INFO:
+        return lane::ledger_data;
+    case protocol::mtGET_PEERS:
+    case protocol::mtPEERS:
+    case protocol::mtENDPOINTS:
+        return lane::discovery;
+    default:
+        return lane::consensus;
+    }
+}
 } 
@@ -4,6 +4,7 @@
 #include <ripple/protocol/messages.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 namespace ripple {
 class TrafficCount
@@ -78,9 +79,52 @@ public:
         get_hash,
         unknown         
     };
+    enum class lane : std::size_t
+    {
+        consensus,
+        transactions,
+        ledger_data,
+        discovery,
+        count
+    };
+    class LaneStats
+    {
+    public:
+        std::string const name;
+        std::atomic<std::uint64_t> messages {0};
+        std::atomic<std::uint64_t> waitTotal {0};
+        std::atomic<std::uint64_t> waitMax {0};
+        LaneStats(char const* n)
+            : name (n)
+        {
+        }
+        LaneStats(LaneStats const& ls)
+            : name (ls.name)
+            , messages (ls.messages.load())
+            , waitTotal (ls.waitTotal.load())
+            , waitMax (ls.waitMax.load())
+        {
+        }
+        operator bool () const
+        {
+            return messages != 0;
+        }
+    };
     static category categorize (
         ::google::protobuf::Message const& message,
         int type, bool inbound);
+    static lane laneOf (int type);
+    void addLaneWait (lane l, std::chrono::microseconds wait)
+    {
+        assert (l < lane::count);
+        auto& stats = lanes_[safe_cast<std::size_t>(l)];
+        auto const us = static_cast<std::uint64_t>(wait.count());
+        ++stats.messages;
+        stats.waitTotal += us;
+        auto max = stats.waitMax.load();
+        while (us > max && ! stats.waitMax.compare_exchange_weak (max, us))
+            ;
+    }
     void addCount (category cat, bool inbound, int bytes)
     {
         assert (cat <= category::unknown);
@@ -101,6 +145,11 @@ public:
     {
         return counts_;
     }
+    auto
+    getLaneCounts () const
+    {
+        return lanes_;
+    }
 protected:
     std::array<TrafficStats, category::unknown + 1> counts_
     {{
@@ -146,6 +195,13 @@ protected:
         { "getobject (get)" },                                    
         { "unknown" }                                             
     }};
+    std::array<LaneStats, safe_cast<std::size_t>(lane::count)> lanes_
+    {{
+        { "consensus" },
+        { "transactions" },
+        { "ledger data" },
+        { "peer discovery" }
+    }};
 };
 }
 #endif
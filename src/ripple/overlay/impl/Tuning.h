@@ -19,6 +19,10 @@ enum
     dropSendQueue       =   192,
     targetSendQueue     =   128,
     sendQueueLogFreq    =    64,
+    consensusLaneBytes  = 65536,
+    transactionLaneBytes = 32768,
+    ledgerDataLaneBytes = 32768,
+    discoveryLaneBytes  =  4096,
 };
 std::chrono::milliseconds constexpr peerHighLatency{300};
 } 
@@ -11,6 +11,7 @@
 #include <cstring>
 #include <ostream>
 #include <utility>
+#include <vector>
 namespace ripple {
 class PublicKey
 {
@@ -150,6 +151,15 @@ verify (PublicKey const& publicKey,
     Slice const& m,
     Slice const& sig,
     bool mustBeFullyCanonical = true);
+struct SignedMessage
+{
+    PublicKey publicKey;
+    Slice message;
+    Slice signature;
+    bool mustBeFullyCanonical;
+};
+std::vector<bool>
+verifyBatch (std::vector<SignedMessage> const& batch);
 NodeID
 calcNodeID (PublicKey const&);
 AccountID
@@ -51,6 +51,7 @@ public:
     }
     std::string getFullText () const override;
     Blob getSignature () const;
+    Blob getSigningData () const;
     uint256 getSigningHash () const;
     TxType getTxnType () const
     {
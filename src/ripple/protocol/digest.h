@@ -1,6 +1,7 @@
 #ifndef RIPPLE_PROTOCOL_DIGEST_H_INCLUDED
 #define RIPPLE_PROTOCOL_DIGEST_H_INCLUDED
 #include <ripple/basics/base_uint.h>
+#include <ripple/basics/Slice.h>
 #include <ripple/beast/crypto/ripemd.h>
 #include <ripple/beast/crypto/sha2.h>
 #include <ripple/beast/hash/endian.h>
@@ -158,6 +159,8 @@ sha512Half (Args const&... args)
     return static_cast<typename
         sha512_half_hasher::result_type>(h);
 }
+void
+sha512HalfBatch (Slice const* messages, uint256* digests, std::size_t count);
 template <class... Args>
 sha512_half_hasher_s::result_type
 sha512Half_s (Args const&... args)
@@ -227,6 +227,41 @@ verify (PublicKey const& publicKey,
     }
     return false;
 }
+std::vector<bool>
+verifyBatch (std::vector<SignedMessage> const& batch)
+{
+    std::vector<bool> result (batch.size(), false);
+    std::vector<std::size_t> index;
+    std::vector<unsigned char const*> m;
+    std::vector<std::size_t> mlen;
+    std::vector<unsigned char const*> pk;
+    std::vector<unsigned char const*> sig;
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        auto const& s = batch[i];
+        if (publicKeyType(s.publicKey) != KeyType::ed25519)
+        {
+            result[i] = verify (s.publicKey,
+                s.message, s.signature, s.mustBeFullyCanonical);
+            continue;
+        }
+        if (! ed25519Canonical(s.signature))
+            continue;
+        index.push_back (i);
+        m.push_back (s.message.data());
+        mlen.push_back (s.message.size());
+        pk.push_back (s.publicKey.data() + 1);
+        sig.push_back (s.signature.data());
+    }
+    if (index.empty())
+        return result;
+    std::vector<int> valid (index.size());
+    ed25519_sign_open_batch (m.data(), mlen.data(),
+        pk.data(), sig.data(), index.size(), valid.data());
+    for (std::size_t i = 0; i < index.size(); ++i)
+        result[index[i]] = valid[i] == 1;
+    return result;
+}
 NodeID
 calcNodeID (PublicKey const& pk)
 {
@@ -1,8 +1,14 @@
 
 #include <ripple/protocol/digest.h>
+#include <cstring>
 #include <type_traits>
+#include <vector>
 #include <openssl/ripemd.h>
 #include <openssl/sha.h>
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RIPPLE_SHA512_MULTIBUFFER 1
+#include <immintrin.h>
+#endif
 namespace ripple {
 openssl_ripemd160_hasher::openssl_ripemd160_hasher()
 {
@@ -79,4 +85,195 @@ openssl_sha256_hasher::operator result_type() noexcept
     SHA256_Final(digest.data(), ctx);
     return digest;
 }
-} 
+namespace detail {
+static
+void
+sha512HalfScalar (Slice const* messages, uint256* digests, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        digests[i] = sha512Half (messages[i]);
+}
+#ifdef RIPPLE_SHA512_MULTIBUFFER
+static std::uint64_t const sha512K[80] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+static std::uint64_t const sha512H0[8] =
+{
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+static std::size_t constexpr sha512Lanes = 4;
+static
+std::size_t
+sha512PaddedSize (std::size_t size)
+{
+    return ((size + 17 + 127) / 128) * 128;
+}
+static
+void
+sha512Pad (Slice const& message, std::uint8_t* out, std::size_t padded)
+{
+    if (message.size () != 0)
+        std::memcpy (out, message.data (), message.size ());
+    std::memset (out + message.size (), 0, padded - message.size ());
+    out[message.size ()] = 0x80;
+    std::uint64_t bits = static_cast<std::uint64_t> (message.size ()) * 8;
+    for (int i = 0; i < 8; ++i, bits >>= 8)
+        out[padded - 1 - i] = static_cast<std::uint8_t> (bits);
+}
+static
+std::uint64_t
+sha512Load (std::uint8_t const* p)
+{
+    std::uint64_t v;
+    std::memcpy (&v, p, sizeof (v));
+    return __builtin_bswap64 (v);
+}
+__attribute__((target("avx2")))
+static inline
+__m256i
+sha512Rotr (__m256i x, int n)
+{
+    return _mm256_or_si256 (
+        _mm256_srli_epi64 (x, n), _mm256_slli_epi64 (x, 64 - n));
+}
+__attribute__((target("avx2")))
+static
+void
+sha512HalfAvx2 (Slice const* messages, uint256* digests, std::size_t count)
+{
+    std::vector<std::uint8_t> buffer;
+    for (std::size_t first = 0; first < count; first += sha512Lanes)
+    {
+        std::size_t const lanes = std::min (sha512Lanes, count - first);
+        std::size_t offsets[sha512Lanes] = {};
+        std::size_t blocks[sha512Lanes] = {};
+        std::size_t total = 0;
+        std::size_t maxBlocks = 0;
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            auto const padded = sha512PaddedSize (messages[first + l].size ());
+            offsets[l] = total;
+            blocks[l] = padded / 128;
+            maxBlocks = std::max (maxBlocks, blocks[l]);
+            total += padded;
+        }
+        buffer.resize (total);
+        for (std::size_t l = 0; l < lanes; ++l)
+            sha512Pad (messages[first + l], buffer.data () + offsets[l],
+                blocks[l] * 128);
+        __m256i state[8];
+        for (int i = 0; i < 8; ++i)
+            state[i] = _mm256_set1_epi64x (sha512H0[i]);
+        for (std::size_t n = 0; n < maxBlocks; ++n)
+        {
+            std::int64_t active[sha512Lanes];
+            std::uint8_t const* block[sha512Lanes];
+            for (std::size_t l = 0; l < sha512Lanes; ++l)
+            {
+                active[l] = (l < lanes && n < blocks[l]) ? -1 : 0;
+                block[l] = buffer.data () +
+                    (active[l] ? offsets[l] + n * 128 : 0);
+            }
+            __m256i w[80];
+            for (int j = 0; j < 16; ++j)
+            {
+                w[j] = _mm256_set_epi64x (
+                    sha512Load (block[3] + j * 8),
+                    sha512Load (block[2] + j * 8),
+                    sha512Load (block[1] + j * 8),
+                    sha512Load (block[0] + j * 8));
+            }
+            for (int j = 16; j < 80; ++j)
+            {
+                auto const s0 = _mm256_xor_si256 (_mm256_xor_si256 (
+                    sha512Rotr (w[j - 15], 1), sha512Rotr (w[j - 15], 8)),
+                        _mm256_srli_epi64 (w[j - 15], 7));
+                auto const s1 = _mm256_xor_si256 (_mm256_xor_si256 (
+                    sha512Rotr (w[j - 2], 19), sha512Rotr (w[j - 2], 61)),
+                        _mm256_srli_epi64 (w[j - 2], 6));
+                w[j] = _mm256_add_epi64 (_mm256_add_epi64 (w[j - 16], s0),
+                    _mm256_add_epi64 (w[j - 7], s1));
+            }
+            __m256i v[8];
+            for (int i = 0; i < 8; ++i)
+                v[i] = state[i];
+            for (int j = 0; j < 80; ++j)
+            {
+                auto const S1 = _mm256_xor_si256 (_mm256_xor_si256 (
+                    sha512Rotr (v[4], 14), sha512Rotr (v[4], 18)),
+                        sha512Rotr (v[4], 41));
+                auto const ch = _mm256_xor_si256 (
+                    _mm256_and_si256 (v[4], v[5]),
+                        _mm256_andnot_si256 (v[4], v[6]));
+                auto const t1 = _mm256_add_epi64 (
+                    _mm256_add_epi64 (_mm256_add_epi64 (v[7], S1), ch),
+                    _mm256_add_epi64 (
+                        _mm256_set1_epi64x (sha512K[j]), w[j]));
+                auto const S0 = _mm256_xor_si256 (_mm256_xor_si256 (
+                    sha512Rotr (v[0], 28), sha512Rotr (v[0], 34)),
+                        sha512Rotr (v[0], 39));
+                auto const maj = _mm256_xor_si256 (_mm256_xor_si256 (
+                    _mm256_and_si256 (v[0], v[1]),
+                        _mm256_and_si256 (v[0], v[2])),
+                            _mm256_and_si256 (v[1], v[2]));
+                v[7] = v[6];
+                v[6] = v[5];
+                v[5] = v[4];
+                v[4] = _mm256_add_epi64 (v[3], t1);
+                v[3] = v[2];
+                v[2] = v[1];
+                v[1] = v[0];
+                v[0] = _mm256_add_epi64 (t1, _mm256_add_epi64 (S0, maj));
+            }
+            auto const mask = _mm256_set_epi64x (
+                active[3], active[2], active[1], active[0]);
+            for (int i = 0; i < 8; ++i)
+                state[i] = _mm256_blendv_epi8 (state[i],
+                    _mm256_add_epi64 (state[i], v[i]), mask);
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            std::uint64_t out[sha512Lanes];
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (out), state[i]);
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                auto const word = __builtin_bswap64 (out[l]);
+                std::memcpy (digests[first + l].data () + i * 8, &word, 8);
+            }
+        }
+    }
+}
+#endif
+}
+void
+sha512HalfBatch (Slice const* messages, uint256* digests, std::size_t count)
+{
+#ifdef RIPPLE_SHA512_MULTIBUFFER
+    static bool const avx2 = __builtin_cpu_supports ("avx2");
+    if (avx2 && count > 1)
+        return detail::sha512HalfAvx2 (messages, digests, count);
+#endif
+    detail::sha512HalfScalar (messages, digests, count);
+}
+}
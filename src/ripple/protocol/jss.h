@@ -93,6 +93,7 @@ JSS ( balances );
 JSS ( base );                       
 JSS ( base_fee );                   
 JSS ( base_fee_xrp );               
+JSS ( batches );                    
 JSS ( bids );                       
 JSS ( binary );                     
 JSS ( books );                      
@@ -116,6 +117,7 @@ JSS ( close_time_resolution );
 JSS ( closed );                     
 JSS ( closed_ledger );              
 JSS ( cluster );                    
+JSS ( coalesced );                  
 JSS ( code );                       
 JSS ( command );                    
 JSS ( complete );                   
@@ -141,6 +143,7 @@ JSS ( delivered_amount );
 JSS ( deposit_authorized );         
 JSS ( deposit_preauth );            
 JSS ( deprecated );                 
+JSS ( depth );                      
 JSS ( descending );                 
 JSS ( destination_account );        
 JSS ( destination_amount );         
@@ -150,6 +153,7 @@ JSS ( dir_entry );
 JSS ( dir_index );                  
 JSS ( dir_root );                   
 JSS ( directory );                  
+JSS ( dropped );                    
 JSS ( drops );                      
 JSS ( duration_us );                
 JSS ( enabled );                    
@@ -194,6 +198,7 @@ JSS ( have_header );
 JSS ( have_state );                 
 JSS ( have_transactions );          
 JSS ( highest_sequence );           
+JSS ( histograms );                 
 JSS ( historical_perminute );       
 JSS ( hostid );                     
 JSS ( hotwallet );                  
@@ -261,6 +266,7 @@ JSS ( max_ledger );
 JSS ( max_queue_size );             
 JSS ( max_spend_drops );            
 JSS ( max_spend_drops_total );      
+JSS ( max_us );                     
 JSS ( median_fee );                 
 JSS ( median_level );               
 JSS ( message );                    
@@ -290,16 +296,21 @@ JSS ( node_reads_total );
 JSS ( node_writes );                
 JSS ( node_written_bytes );         
 JSS ( nodes );                      
+JSS ( nodes_per_second );           
 JSS ( obligations );                
 JSS ( offer );                      
 JSS ( offers );                     
 JSS ( offline );                    
 JSS ( offset );                     
+JSS ( online_delete );              
 JSS ( open );                       
 JSS ( open_ledger_fee );            
 JSS ( open_ledger_level );          
 JSS ( owner );                      
 JSS ( owner_funds );                
+JSS ( p50_us );                     
+JSS ( p999_us );                    
+JSS ( p99_us );                     
 JSS ( params );                     
 JSS ( parent_close_time );          
 JSS ( parent_hash );                
@@ -339,6 +350,7 @@ JSS ( queued );
 JSS ( queued_duration_us );
 JSS ( random );                     
 JSS ( raw_meta );                   
+JSS ( read_queue );                 
 JSS ( receive_currencies );         
 JSS ( reference_level );            
 JSS ( refresh_interval_min );       
@@ -357,6 +369,7 @@ JSS ( ripplerpc );
 JSS ( role );                       
 JSS ( rpc );
 JSS ( rt_accounts );                
+JSS ( running );                    
 JSS ( running_duration_us );
 JSS ( sanity );                     
 JSS ( search_depth );               
@@ -367,12 +380,14 @@ JSS ( send_currencies );
 JSS ( send_max );                   
 JSS ( seq );                        
 JSS ( seqNum );                     
+JSS ( served );                     
 JSS ( server_state );               
 JSS ( server_state_duration_us );   
 JSS ( server_status );              
 JSS ( settle_delay );               
 JSS ( severity );                   
 JSS ( shards );                     
+JSS ( sig_verify );                 
 JSS ( signature );                  
 JSS ( signature_verified );         
 JSS ( signing_key );                
@@ -406,6 +421,7 @@ JSS ( taker_gets );
 JSS ( taker_gets_funded );          
 JSS ( taker_pays );                 
 JSS ( taker_pays_funded );          
+JSS ( threads );                    
 JSS ( threshold );                  
 JSS ( ticket );                     
 JSS ( time );
@@ -449,6 +465,7 @@ JSS ( validator_list );
 JSS ( validators );
 JSS ( validated_ledger );           
 JSS ( validated_ledgers );          
+JSS ( validating_shards );          
 JSS ( validation_key );             
 JSS ( validation_private_key );     
 JSS ( validation_public_key );      
@@ -460,6 +477,7 @@ JSS ( value );
 JSS ( version );                    
 JSS ( vetoed );                     
 JSS ( vote );                       
+JSS ( wait_ms );                    
 JSS ( warning );                    
 JSS ( workers );
 JSS ( write_load );                 
@@ -4,10 +4,14 @@
 #include <ripple/net/InfoSub.h>
 #include <ripple/rpc/Context.h>
 #include <ripple/rpc/Status.h>
+namespace Json {
+class Object;
+}
 namespace ripple {
 namespace RPC {
 struct Context;
 Status doCommand (RPC::Context&, Json::Value&);
+Status doCommand (RPC::Context&, Json::Object&);
 Role roleRequired (std::string const& method );
 } 
 } 
@@ -1,6 +1,7 @@
 #ifndef RIPPLE_RPC_SHARDARCHIVEHANDLER_H_INCLUDED
 #define RIPPLE_RPC_SHARDARCHIVEHANDLER_H_INCLUDED
 #include <ripple/app/main/Application.h>
+#include <ripple/basics/Archive.h>
 #include <ripple/basics/BasicConfig.h>
 #include <ripple/basics/StringUtilities.h>
 #include <ripple/net/SSLHTTPDownloader.h>
@@ -39,6 +40,7 @@ private:
     boost::asio::basic_waitable_timer<std::chrono::steady_clock> timer_;
     bool process_;
     std::map<std::uint32_t, parsedURL> archives_;
+    std::shared_ptr<TarLz4Stream> extractor_;
     beast::Journal j_;
 };
 } 
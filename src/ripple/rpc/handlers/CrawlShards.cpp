@@ -33,6 +33,9 @@ doCrawlShards(RPC::Context& context)
             jvResult[jss::public_key] = toBase58(
                 TokenType::NodePublic, context.app.nodeIdentity().first);
         jvResult[jss::complete_shards] = shardStore->getCompleteShards();
+        auto progress {shardStore->getValidationProgress()};
+        if (progress.size() > 0)
+            jvResult[jss::validating_shards] = std::move(progress);
     }
     if (hops == 0)
         context.loadType = Resource::feeMediumBurdenRPC;
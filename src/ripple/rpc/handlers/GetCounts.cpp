@@ -4,6 +4,7 @@
 #include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/NetworkOPs.h>
+#include <ripple/app/misc/SignatureVerifier.h>
 #include <ripple/basics/UptimeClock.h>
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/json/json_value.h>
@@ -78,6 +79,8 @@ Json::Value getCountsJson(Application& app, int minObjectCount)
     ret[jss::node_reads_hit] = app.getNodeStore().getFetchHitCount();
     ret[jss::node_written_bytes] = app.getNodeStore().getStoreSize();
     ret[jss::node_read_bytes] = app.getNodeStore().getFetchSize();
+    app.getNodeStore().getCountsJson(ret);
+    app.getSignatureVerifier().getCountsJson(ret);
     if (auto shardStore = app.getShardStore())
     {
         Json::Value& jv = (ret[jss::shards] = Json::objectValue);
@@ -94,6 +97,7 @@ Json::Value getCountsJson(Application& app, int minObjectCount)
         jv[jss::node_reads_hit] = shardStore->getFetchHitCount();
         jv[jss::node_written_bytes] = shardStore->getStoreSize();
         jv[jss::node_read_bytes] = shardStore->getFetchSize();
+        shardStore->getCountsJson(jv);
     }
     return ret;
 }
@@ -0,0 +1,84 @@
+#ifndef RIPPLE_RPC_HANDLERS_LEDGERDATA_H_INCLUDED
+#define RIPPLE_RPC_HANDLERS_LEDGERDATA_H_INCLUDED
+#include <ripple/app/ledger/LedgerToJson.h>
+#include <ripple/ledger/ReadView.h>
+#include <ripple/json/Object.h>
+#include <ripple/protocol/jss.h>
+#include <ripple/rpc/Context.h>
+#include <ripple/rpc/Status.h>
+#include <ripple/rpc/impl/Handler.h>
+#include <ripple/rpc/Role.h>
+#include <boost/optional.hpp>
+namespace ripple {
+namespace RPC {
+struct Context;
+class LedgerDataHandler {
+public:
+    explicit LedgerDataHandler (Context&);
+    Status check ();
+    template <class Object>
+    void writeResult (Object&);
+    static char const* name()
+    {
+        return "ledger_data";
+    }
+    static Role role()
+    {
+        return Role::USER;
+    }
+    static Condition condition()
+    {
+        return NO_CONDITION;
+    }
+private:
+    Context& context_;
+    std::shared_ptr<ReadView const> ledger_;
+    Json::Value result_;
+    ReadView::key_type key_;
+    bool isMarker_ = false;
+    bool isBinary_ = false;
+    int limit_ = -1;
+    LedgerEntryType type_ = ltINVALID;
+};
+template <class Object>
+void LedgerDataHandler::writeResult (Object& value)
+{
+    Json::copyFrom (value, result_);
+    if (! isMarker_)
+    {
+        value[jss::ledger] = getJson (
+            LedgerFill (*ledger_, isBinary_ ?
+                LedgerFill::Options::binary : 0));
+    }
+    boost::optional<ReadView::key_type> marker;
+    {
+        auto&& nodes = Json::setArray (value, jss::state);
+        auto limit = limit_;
+        auto e = ledger_->sles.end();
+        for (auto i = ledger_->sles.upper_bound(key_); i != e; ++i)
+        {
+            auto sle = ledger_->read(keylet::unchecked((*i)->key()));
+            if (limit-- <= 0)
+            {
+                auto k = sle->key();
+                marker = --k;
+                break;
+            }
+            if (type_ == ltINVALID || sle->getType () == type_)
+            {
+                Json::Value entry (Json::objectValue);
+                if (isBinary_)
+                    entry[jss::data] = serializeHex(*sle);
+                else
+                    entry = sle->getJson (JsonOptions::none);
+                entry[jss::index] = to_string(sle->key());
+                nodes.append (entry);
+            }
+        }
+    }
+    if (marker)
+        value[jss::marker] = to_string(*marker);
+}
+}
+}
+#endif
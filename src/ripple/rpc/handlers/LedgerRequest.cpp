@@ -54,7 +54,7 @@ Json::Value doLedgerRequest (RPC::Context& context)
             if (! ledger)
             {
                 if (auto il = context.app.getInboundLedgers().acquire (
-                        *refHash, refIndex, InboundLedger::Reason::GENERIC))
+                        *refHash, refIndex, InboundLedger::Reason::CLIENT))
                 {
                     Json::Value jvResult = RPC::make_error(
                         rpcLGR_NOT_FOUND,
@@ -78,7 +78,7 @@ Json::Value doLedgerRequest (RPC::Context& context)
         ledgerHash = neededHash ? *neededHash : beast::zero; 
     }
     auto ledger = context.app.getInboundLedgers().acquire (
-        ledgerHash, ledgerIndex, InboundLedger::Reason::GENERIC);
+        ledgerHash, ledgerIndex, InboundLedger::Reason::CLIENT);
     if (! ledger && context.app.config().standalone())
         ledger = ledgerMaster.getLedgerByHash (ledgerHash);
     if (ledger)
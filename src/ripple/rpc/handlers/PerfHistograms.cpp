@@ -0,0 +1,9 @@
+#include <ripple/app/main/Application.h>
+#include <ripple/basics/PerfLog.h>
+#include <ripple/rpc/impl/Handler.h>
+namespace ripple {
+Json::Value doPerfHistograms (RPC::Context& context)
+{
+    return context.app.getPerfLog().histogramsJson();
+}
+}
@@ -70,6 +70,12 @@ Json::Value doSubscribe (RPC::Context& context)
     {
         ispSub  = context.infoSub;
     }
+    if (context.params.isMember (jss::binary))
+    {
+        if (! context.params[jss::binary].isBool ())
+            return rpcError (rpcINVALID_PARAMS);
+        ispSub->setBinary (context.params[jss::binary].asBool ());
+    }
     if (context.params.isMember (jss::streams))
     {
         if (! context.params[jss::streams].isArray ())
@@ -1,6 +1,7 @@
 
 #include <ripple/rpc/impl/Handler.h>
 #include <ripple/rpc/handlers/Handlers.h>
+#include <ripple/rpc/handlers/LedgerData.h>
 #include <ripple/rpc/handlers/Version.h>
 namespace ripple {
 namespace RPC {
@@ -57,7 +58,6 @@ Handler const handlerArray[] {
     {   "ledger_cleaner",       byRef (&doLedgerCleaner),       Role::ADMIN,   NEEDS_NETWORK_CONNECTION  },
     {   "ledger_closed",        byRef (&doLedgerClosed),        Role::USER,  NO_CONDITION   },
     {   "ledger_current",       byRef (&doLedgerCurrent),       Role::USER,  NEEDS_CURRENT_LEDGER  },
-    {   "ledger_data",          byRef (&doLedgerData),          Role::USER,  NO_CONDITION  },
     {   "ledger_entry",         byRef (&doLedgerEntry),         Role::USER,  NO_CONDITION  },
     {   "ledger_header",        byRef (&doLedgerHeader),        Role::USER,  NO_CONDITION  },
     {   "ledger_request",       byRef (&doLedgerRequest),       Role::ADMIN,   NO_CONDITION     },
@@ -67,6 +67,7 @@ Handler const handlerArray[] {
     {   "owner_info",           byRef (&doOwnerInfo),           Role::USER,  NEEDS_CURRENT_LEDGER  },
     {   "peers",                byRef (&doPeers),               Role::ADMIN,   NO_CONDITION     },
     {   "path_find",            byRef (&doPathFind),            Role::USER,  NEEDS_CURRENT_LEDGER  },
+    {   "perf_histograms",      byRef (&doPerfHistograms),      Role::ADMIN,   NO_CONDITION     },
     {   "ping",                 byRef (&doPing),                Role::USER,  NO_CONDITION     },
     {   "print",                byRef (&doPrint),               Role::ADMIN,   NO_CONDITION     },
     {   "random",               byRef (&doRandom),              Role::USER,  NO_CONDITION     },
@@ -103,6 +104,7 @@ class HandlerTable {
             table_[entry.name_] = entry;
         }
         addHandler<LedgerHandler>();
+        addHandler<LedgerDataHandler>();
         addHandler<VersionHandler>();
     }
   public:
@@ -134,6 +136,7 @@ class HandlerTable {
         Handler h;
         h.name_ = HandlerImpl::name();
         h.valueMethod_ = &handle<Json::Value, HandlerImpl>;
+        h.objectMethod_ = &handle<Json::Object, HandlerImpl>;
         h.role_ = HandlerImpl::role();
         h.condition_ = HandlerImpl::condition();
         table_[HandlerImpl::name()] = h;
@@ -148,6 +148,25 @@ void getResult (
         result[jss::status] = jss::success;
     }
 }
+template <class Object, class Method>
+Status runMethod (
+    Context& context, Handler const& handler, Method const& method,
+    Object& result)
+{
+    if (! context.headers.user.empty() ||
+        ! context.headers.forwardedFor.empty())
+    {
+        JLOG(context.j.debug()) << "start command: " << handler.name_ <<
+            ", user: " << context.headers.user << ", forwarded for: " <<
+                context.headers.forwardedFor;
+        auto ret = callMethod (context, method, handler.name_, result);
+        JLOG(context.j.debug()) << "finish command: " << handler.name_ <<
+            ", user: " << context.headers.user << ", forwarded for: " <<
+                context.headers.forwardedFor;
+        return ret;
+    }
+    return callMethod (context, method, handler.name_, result);
+}
 } 
 Status doCommand (
     RPC::Context& context, Json::Value& result)
@@ -158,24 +177,27 @@ Status doCommand (
         inject_error (error, result);
         return error;
     }
+    if (auto method = handler->valueMethod_)
+        return runMethod (context, *handler, method, result);
+    return rpcUNKNOWN_COMMAND;
+}
+Status doCommand (
+    RPC::Context& context, Json::Object& result)
+{
+    Handler const * handler = nullptr;
+    if (auto error = fillHandler (context, handler))
+    {
+        inject_error (error, result);
+        return error;
+    }
+    if (auto method = handler->objectMethod_)
+        return runMethod (context, *handler, method, result);
     if (auto method = handler->valueMethod_)
     {
-        if (! context.headers.user.empty() ||
-            ! context.headers.forwardedFor.empty())
-        {
-            JLOG(context.j.debug()) << "start command: " << handler->name_ <<
-                ", user: " << context.headers.user << ", forwarded for: " <<
-                    context.headers.forwardedFor;
-            auto ret = callMethod (context, method, handler->name_, result);
-            JLOG(context.j.debug()) << "finish command: " << handler->name_ <<
-                ", user: " << context.headers.user << ", forwarded for: " <<
-                    context.headers.forwardedFor;
-            return ret;
-        }
-        else
-        {
-            return callMethod (context, method, handler->name_, result);
-        }
+        Json::Value value;
+        auto ret = runMethod (context, *handler, method, value);
+        Json::copyFrom (result, value);
+        return ret;
     }
     return rpcUNKNOWN_COMMAND;
 }
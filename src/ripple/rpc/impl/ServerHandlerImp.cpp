@@ -5,6 +5,7 @@
 #include <ripple/beast/rfc2616.h>
 #include <ripple/beast/net/IPAddressConversion.h>
 #include <ripple/json/json_reader.h>
+#include <ripple/json/Object.h>
 #include <ripple/rpc/json_body.h>
 #include <ripple/rpc/ServerHandler.h>
 #include <ripple/server/Server.h>
@@ -19,6 +20,7 @@
 #include <ripple/overlay/Overlay.h>
 #include <ripple/resource/ResourceManager.h>
 #include <ripple/resource/Fees.h>
+#include <ripple/rpc/impl/Handler.h>
 #include <ripple/rpc/impl/Tuning.h>
 #include <ripple/rpc/Role.h>
 #include <ripple/rpc/RPCHandler.h>
@@ -425,7 +427,7 @@ void
 ServerHandlerImp::processSession (std::shared_ptr<Session> const& session,
     std::shared_ptr<JobQueue::Coro> coro)
 {
-    processRequest (
+    auto const streamed = processRequest (
         session->port(), buffers_to_string(
             session->request().body().data()),
                 session->remoteAddress().at_port (0),
@@ -438,7 +440,10 @@ ServerHandlerImp::processSession (std::shared_ptr<Session> const& session,
             if(iter != session->request().end())
                 return iter->value();
             return boost::beast::string_view{};
-        }());
+        }(),
+        session->request().version() >= 11 ? session : nullptr);
+    if (streamed)
+        return;
     if(beast::rfc2616::is_keep_alive(session->request()))
         session->complete();
     else
@@ -446,6 +451,23 @@ ServerHandlerImp::processSession (std::shared_ptr<Session> const& session,
 }
 static
 Json::Value
+maskedRequest (Json::Value rq)
+{
+    if (rq.isObject())
+    {
+        if (rq.isMember(jss::passphrase.c_str()))
+            rq[jss::passphrase.c_str()] = "<masked>";
+        if (rq.isMember(jss::secret.c_str()))
+            rq[jss::secret.c_str()] = "<masked>";
+        if (rq.isMember(jss::seed.c_str()))
+            rq[jss::seed.c_str()] = "<masked>";
+        if (rq.isMember(jss::seed_hex.c_str()))
+            rq[jss::seed_hex.c_str()] = "<masked>";
+    }
+    return rq;
+}
+static
+Json::Value
 make_json_error(Json::Int code, Json::Value&& message)
 {
     Json::Value sub{Json::objectValue};
@@ -458,11 +480,12 @@ make_json_error(Json::Int code, Json::Value&& message)
 Json::Int constexpr method_not_found  = -32601;
 Json::Int constexpr server_overloaded = -32604;
 Json::Int constexpr forbidden         = -32605;
-void
+bool
 ServerHandlerImp::processRequest (Port const& port,
     std::string const& request, beast::IP::Endpoint const& remoteIPAddress,
         Output&& output, std::shared_ptr<JobQueue::Coro> coro,
-        boost::string_view forwardedFor, boost::string_view user)
+        boost::string_view forwardedFor, boost::string_view user,
+        std::shared_ptr<Session> const& chunked)
 {
     auto rpcJ = app_.journal ("RPC");
     Json::Value jsonOrig;
@@ -475,7 +498,7 @@ ServerHandlerImp::processRequest (Port const& port,
         {
             HTTPReply (400, "Unable to parse request: " +
                        reader.getFormatedErrorMessages(), output, rpcJ);
-            return;
+            return false;
         }
     }
     bool batch = false;
@@ -486,7 +509,7 @@ ServerHandlerImp::processRequest (Port const& port,
         if(!jsonOrig.isMember(jss::params) || !jsonOrig[jss::params].isArray())
         {
             HTTPReply (400, "Malformed batch request", output, rpcJ);
-            return;
+            return false;
         }
         size = jsonOrig[jss::params].size();
     }
@@ -540,7 +563,7 @@ ServerHandlerImp::processRequest (Port const& port,
                 if (!batch)
                 {
                     HTTPReply(503, "Server is overloaded", output, rpcJ);
-                    return;
+                    return false;
                 }
                 Json::Value r = jsonRPC;
                 r[jss::error] = make_json_error(server_overloaded, "Server is overloaded");
@@ -554,7 +577,7 @@ ServerHandlerImp::processRequest (Port const& port,
             if (!batch)
             {
                 HTTPReply (403, "Forbidden", output, rpcJ);
-                return;
+                return false;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(forbidden, "Forbidden");
@@ -567,7 +590,7 @@ ServerHandlerImp::processRequest (Port const& port,
             if (!batch)
             {
                 HTTPReply (400, "Null method", output, rpcJ);
-                return;
+                return false;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(method_not_found, "Null method");
@@ -581,7 +604,7 @@ ServerHandlerImp::processRequest (Port const& port,
             if (!batch)
             {
                 HTTPReply (400, "method is not string", output, rpcJ);
-                return;
+                return false;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(method_not_found, "method is not string");
@@ -595,7 +618,7 @@ ServerHandlerImp::processRequest (Port const& port,
             if (!batch)
             {
                 HTTPReply (400, "method is empty", output, rpcJ);
-                return;
+                return false;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(method_not_found, "method is empty");
@@ -612,7 +635,7 @@ ServerHandlerImp::processRequest (Port const& port,
             {
                 usage.charge(Resource::feeInvalidRPC);
                 HTTPReply (400, "params unparseable", output, rpcJ);
-                return;
+                return false;
             }
             else
             {
@@ -621,7 +644,7 @@ ServerHandlerImp::processRequest (Port const& port,
                 {
                     usage.charge(Resource::feeInvalidRPC);
                     HTTPReply (400, "params unparseable", output, rpcJ);
-                    return;
+                    return false;
                 }
             }
         }
@@ -638,7 +661,7 @@ ServerHandlerImp::processRequest (Port const& port,
                 if (!batch)
                 {
                     HTTPReply(400, "ripplerpc is not a string", output, rpcJ);
-                    return;
+                    return false;
                 }
                 Json::Value r = jsonRPC;
                 r[jss::error] = make_json_error(
@@ -662,6 +685,87 @@ ServerHandlerImp::processRequest (Port const& port,
         RPC::Context context {m_journal, params, app_, loadType, m_networkOPs,
             app_.getLedgerMaster(), usage, role, coro, InfoSub::pointer(),
             {user, forwardedFor}};
+        if (! batch && chunked && coro && ripplerpc < "2.0")
+        {
+            auto const handler = RPC::getHandler (strMethod);
+            if (handler && handler->objectMethod_)
+            {
+                HTTPChunkedReply body (200,
+                    [&coro]
+                    {
+                        coro->yield ();
+                    },
+                    [coro]
+                    {
+                        if (! coro->post ())
+                            coro->resume ();
+                    });
+                chunked->write (body.writer (),
+                    beast::rfc2616::is_keep_alive (chunked->request ()));
+                try
+                {
+                    {
+                        Json::Writer writer (body.output ());
+                        Json::Object::Root root (writer);
+                        {
+                            auto result = Json::addObject (root, jss::result);
+                            auto const status = RPC::doCommand (context, result);
+                            usage.charge (loadType);
+                            if (usage.warn())
+                                result[jss::warning] = jss::load;
+                            if (status)
+                            {
+                                result[jss::status] = jss::error;
+                                result[jss::request] = maskedRequest (params);
+                                JLOG (m_journal.debug()) <<
+                                    "rpcError: " << status.toString ();
+                            }
+                            else
+                            {
+                                result[jss::status] = jss::success;
+                            }
+                        }
+                        if (params.isMember(jss::jsonrpc))
+                            root[jss::jsonrpc] = params[jss::jsonrpc];
+                        if (params.isMember(jss::ripplerpc))
+                            root[jss::ripplerpc] = params[jss::ripplerpc];
+                        if (params.isMember(jss::id))
+                            root[jss::id] = params[jss::id];
+                    }
+                    body.write ("\n");
+                    body.finish ();
+                }
+                catch (std::exception const& ex)
+                {
+                    auto const gone = body.closed ();
+                    body.abort ();
+                    chunked->close (false);
+                    if (gone)
+                    {
+                        JLOG (m_journal.debug()) <<
+                            "Reply: client closed connection after " <<
+                            body.size() << " streamed bytes";
+                    }
+                    else
+                    {
+                        JLOG (m_journal.error()) <<
+                            "Exception while streaming " << strMethod <<
+                            ": " << ex.what() << ", closing connection after " <<
+                            body.size() << " bytes";
+                    }
+                    return true;
+                }
+                rpc_time_.notify (
+                    std::chrono::duration_cast <std::chrono::milliseconds> (
+                        std::chrono::high_resolution_clock::now () - start));
+                ++rpc_requests_;
+                rpc_size_.notify (
+                    beast::insight::Event::value_type{body.size()});
+                JLOG (m_journal.debug()) <<
+                    "Reply: streamed " << body.size() << " bytes";
+                return true;
+            }
+        }
         Json::Value result;
         RPC::doCommand (context, result);
         usage.charge (loadType);
@@ -691,20 +795,8 @@ ServerHandlerImp::processRequest (Port const& port,
         {
             if (result.isMember (jss::error))
             {
-                auto rq = params;
-                if (rq.isObject())
-                { 
-                    if (rq.isMember(jss::passphrase.c_str()))
-                        rq[jss::passphrase.c_str()] = "<masked>";
-                    if (rq.isMember(jss::secret.c_str()))
-                        rq[jss::secret.c_str()] = "<masked>";
-                    if (rq.isMember(jss::seed.c_str()))
-                        rq[jss::seed.c_str()] = "<masked>";
-                    if (rq.isMember(jss::seed_hex.c_str()))
-                        rq[jss::seed_hex.c_str()] = "<masked>";
-                }
                 result[jss::status] = jss::error;
-                result[jss::request] = rq;
+                result[jss::request] = maskedRequest (params);
                 JLOG (m_journal.debug())  <<
                     "rpcError: " << result [jss::error] <<
                     ": " << result [jss::error_message];
@@ -742,6 +834,7 @@ ServerHandlerImp::processRequest (Port const& port,
             stream << "Reply: " << response.substr (0, maxSize);
     }
     HTTPReply (200, response, output, rpcJ);
+    return false;
 }
 
 Handoff
@@ -117,11 +117,12 @@ private:
     void
     processSession (std::shared_ptr<Session> const&,
         std::shared_ptr<JobQueue::Coro> coro);
-    void
+    bool
     processRequest (Port const& port, std::string const& request,
         beast::IP::Endpoint const& remoteIPAddress, Output&&,
         std::shared_ptr<JobQueue::Coro> coro,
-        boost::string_view forwardedFor, boost::string_view user);
+        boost::string_view forwardedFor, boost::string_view user,
+        std::shared_ptr<Session> const& chunked);
     Handoff
     statusResponse(http_request_type const& request) const;
 };
@@ -24,6 +24,11 @@ ShardArchiveHandler::~ShardArchiveHandler()
 {
     std::lock_guard<std::mutex> lock(m_);
     timer_.cancel();
+    if (extractor_)
+    {
+        extractor_->abort();
+        extractor_.reset();
+    }
     for (auto const& ar : archives_)
         app_.getShardStore()->removePreShard(ar.first);
     archives_.clear();
@@ -122,12 +127,27 @@ ShardArchiveHandler::next(std::lock_guard<std::mutex>& l)
         return next(l);
     }
     auto const& url {archives_.begin()->second};
-    if (!downloader_->download(
+    try
+    {
+        extractor_ = std::make_shared<TarLz4Stream>(dstDir);
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.error()) <<
+            "exception: " << e.what();
+        remove(l);
+        return next(l);
+    }
+    if (!downloader_->stream(
         url.domain,
         std::to_string(url.port.get_value_or(443)),
         url.path,
         11,
-        dstDir / "archive.tar.lz4",
+        dstDir,
+        [extractor = extractor_](void const* data, std::size_t size)
+        {
+            extractor->write(data, size);
+        },
         std::bind(&ShardArchiveHandler::complete,
             shared_from_this(), std::placeholders::_1)))
     {
@@ -142,23 +162,12 @@ ShardArchiveHandler::complete(path dstPath)
 {
     {
         std::lock_guard<std::mutex> lock(m_);
-        try
-        {
-            if (!is_regular_file(dstPath))
-            {
-                auto ar {archives_.begin()};
-                JLOG(j_.error()) <<
-                    "Downloading shard id " << ar->first <<
-                    " form URL " << ar->second.domain << ar->second.path;
-                remove(lock);
-                next(lock);
-                return;
-            }
-        }
-        catch (std::exception const& e)
+        if (dstPath.empty())
         {
+            auto ar {archives_.begin()};
             JLOG(j_.error()) <<
-                "exception: " << e.what();
+                "Downloading shard id " << ar->first <<
+                " form URL " << ar->second.domain << ar->second.path;
             remove(lock);
             next(lock);
             return;
@@ -195,14 +204,16 @@ void
 ShardArchiveHandler::process(path const& dstPath)
 {
     std::uint32_t shardIndex;
+    std::shared_ptr<TarLz4Stream> extractor;
     {
         std::lock_guard<std::mutex> lock(m_);
         shardIndex = archives_.begin()->first;
+        extractor = extractor_;
     }
-    auto const shardDir {dstPath.parent_path() / std::to_string(shardIndex)};
+    auto const shardDir {dstPath / std::to_string(shardIndex)};
     try
     {
-        extractTarLz4(dstPath, dstPath.parent_path());
+        extractor->finish();
         if (!is_directory(shardDir))
         {
             JLOG(j_.error()) <<
@@ -229,6 +240,11 @@ ShardArchiveHandler::process(path const& dstPath)
 void
 ShardArchiveHandler::remove(std::lock_guard<std::mutex>&)
 {
+    if (extractor_)
+    {
+        extractor_->abort();
+        extractor_.reset();
+    }
     auto const shardIndex {archives_.begin()->first};
     app_.getShardStore()->removePreShard(shardIndex);
     archives_.erase(shardIndex);
@@ -40,22 +40,18 @@ public:
         return fwdfor_;
     }
     void
-    send(Json::Value const& jv, bool) override
+    send(Json::Value const& jv, bool broadcast) override
+    {
+        send(Message(jv), broadcast);
+    }
+    void
+    send(Message const& msg, bool) override
     {
         auto sp = ws_.lock();
         if(! sp)
             return;
-        boost::beast::multi_buffer sb;
-        Json::stream(jv,
-            [&](void const* data, std::size_t n)
-            {
-                sb.commit(boost::asio::buffer_copy(
-                    sb.prepare(n), boost::asio::buffer(data, n)));
-            });
-        auto m = std::make_shared<
-            StreambufWSMsg<decltype(sb)>>(
-                std::move(sb));
-        sp->send(m);
+        sp->send(std::make_shared<SharedWSMsg>(
+            msg.text(isBinary())));
     }
 };
 } 
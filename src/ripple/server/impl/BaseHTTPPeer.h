@@ -334,9 +334,11 @@ do_writer(std::shared_ptr <Writer> const& writer,
         if(! writer->prepare(bufferSize, resume))
             return;
         error_code ec;
+        start_timer();
         auto const bytes_transferred = boost::asio::async_write(
             impl().stream_, writer->data(), boost::asio::transfer_at_least(1),
                 do_yield[ec]);
+        cancel_timer();
         if(ec)
             return fail(ec, "writer");
         writer->consume(bytes_transferred);
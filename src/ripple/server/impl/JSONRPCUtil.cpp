@@ -1,11 +1,17 @@
 
 #include <ripple/basics/Log.h>
+#include <ripple/basics/contract.h>
 #include <ripple/server/impl/JSONRPCUtil.h>
 #include <ripple/protocol/jss.h>
 #include <ripple/protocol/BuildInfo.h>
 #include <ripple/protocol/SystemParameters.h>
 #include <ripple/json/to_string.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/core/uncaught_exceptions.hpp>
+#include <cassert>
+#include <deque>
+#include <mutex>
+#include <sstream>
 namespace ripple {
 std::string getHTTPHeaderTimestamp ()
 {
@@ -23,6 +29,28 @@ std::string getHTTPHeaderTimestamp ()
         &now_gmt);
     return std::string (buffer);
 }
+static
+void writeStatusLine (int nStatus, Json::Output const& output)
+{
+    switch (nStatus)
+    {
+    case 200: output ("HTTP/1.1 200 OK\r\n"); break;
+    case 400: output ("HTTP/1.1 400 Bad Request\r\n"); break;
+    case 403: output ("HTTP/1.1 403 Forbidden\r\n"); break;
+    case 404: output ("HTTP/1.1 404 Not Found\r\n"); break;
+    case 500: output ("HTTP/1.1 500 Internal Server Error\r\n"); break;
+    case 503: output ("HTTP/1.1 503 Server is overloaded\r\n"); break;
+    }
+}
+static
+void writeServerHeaders (Json::Output const& output)
+{
+    output ("Content-Type: application/json; charset=UTF-8\r\n");
+    output ("Server: " + systemName () + "-json-rpc/");
+    output (BuildInfo::getFullVersionString ());
+    output ("\r\n"
+            "\r\n");
+}
 void HTTPReply (
     int nStatus, std::string const& content, Json::Output const& output, beast::Journal j)
 {
@@ -51,26 +79,248 @@ void HTTPReply (
                     "<BODY><H1>401 Unauthorized.</H1></BODY>\r\n");
         return;
     }
-    switch (nStatus)
-    {
-    case 200: output ("HTTP/1.1 200 OK\r\n"); break;
-    case 400: output ("HTTP/1.1 400 Bad Request\r\n"); break;
-    case 403: output ("HTTP/1.1 403 Forbidden\r\n"); break;
-    case 404: output ("HTTP/1.1 404 Not Found\r\n"); break;
-    case 500: output ("HTTP/1.1 500 Internal Server Error\r\n"); break;
-    case 503: output ("HTTP/1.1 503 Server is overloaded\r\n"); break;
-    }
+    writeStatusLine (nStatus, output);
     output (getHTTPHeaderTimestamp ());
     output ("Connection: Keep-Alive\r\n"
             "Content-Length: ");
     output (std::to_string(content.size () + 2));
-    output ("\r\n"
-            "Content-Type: application/json; charset=UTF-8\r\n");
-    output ("Server: " + systemName () + "-json-rpc/");
-    output (BuildInfo::getFullVersionString ());
-    output ("\r\n"
-            "\r\n");
+    output ("\r\n");
+    writeServerHeaders (output);
     output (content);
     output ("\r\n");
 }
+class HTTPChunkedReply::Stream
+{
+public:
+    explicit Stream (std::function<void(void)> resume)
+        : resumeProducer_ (std::move (resume))
+    {
+    }
+    bool push (std::string&& data, bool last)
+    {
+        std::function<void(void)> resume;
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            if (closed_ || aborted_)
+                return false;
+            queued_ += data.size ();
+            chunks_.push_back (std::move (data));
+            finished_ = last;
+            std::swap (resume, resumeWriter_);
+        }
+        if (resume)
+            resume ();
+        return true;
+    }
+    bool wait ()
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        if (closed_ || queued_ < maxQueued)
+            return false;
+        waiting_ = true;
+        return true;
+    }
+    bool isClosed ()
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        return closed_;
+    }
+    void abort ()
+    {
+        std::function<void(void)> producer;
+        std::function<void(void)> writer;
+        std::lock_guard<std::mutex> lock (mutex_);
+        aborted_ = true;
+        waiting_ = false;
+        std::swap (producer, resumeProducer_);
+        std::swap (writer, resumeWriter_);
+    }
+    void close ()
+    {
+        std::function<void(void)> resume;
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            closed_ = true;
+            if (waiting_)
+                resume = resumeProducer_;
+            waiting_ = false;
+        }
+        if (resume)
+            resume ();
+    }
+    bool prepare (std::function<void(void)> resume)
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        if (aborted_)
+            return false;
+        if (! chunks_.empty ())
+            return true;
+        resumeWriter_ = std::move (resume);
+        return false;
+    }
+    std::vector<boost::asio::const_buffer> data ()
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        std::vector<boost::asio::const_buffer> result;
+        result.reserve (chunks_.size ());
+        auto offset = offset_;
+        for (auto const& chunk : chunks_)
+        {
+            result.emplace_back (chunk.data () + offset, chunk.size () - offset);
+            offset = 0;
+        }
+        return result;
+    }
+    void consume (std::size_t bytes)
+    {
+        std::function<void(void)> resume;
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            queued_ -= bytes;
+            bytes += offset_;
+            while (! chunks_.empty () && bytes >= chunks_.front ().size ())
+            {
+                bytes -= chunks_.front ().size ();
+                chunks_.pop_front ();
+            }
+            offset_ = bytes;
+            if (waiting_ && queued_ <= maxQueued / 2)
+            {
+                resume = resumeProducer_;
+                waiting_ = false;
+            }
+        }
+        if (resume)
+            resume ();
+    }
+    bool complete ()
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        return finished_ && chunks_.empty ();
+    }
+private:
+    std::mutex mutex_;
+    std::deque<std::string> chunks_;
+    std::size_t offset_ = 0;
+    std::size_t queued_ = 0;
+    bool finished_ = false;
+    bool aborted_ = false;
+    bool closed_ = false;
+    bool waiting_ = false;
+    std::function<void(void)> resumeProducer_;
+    std::function<void(void)> resumeWriter_;
+};
+class HTTPChunkedReply::StreamWriter : public Writer
+{
+    std::shared_ptr<Stream> stream_;
+public:
+    explicit StreamWriter (std::shared_ptr<Stream> stream)
+        : stream_ (std::move (stream))
+    {
+    }
+    ~StreamWriter () override
+    {
+        stream_->close ();
+    }
+    bool complete () override
+    {
+        return stream_->complete ();
+    }
+    void consume (std::size_t bytes) override
+    {
+        stream_->consume (bytes);
+    }
+    bool prepare (std::size_t,
+        std::function<void(void)> resume) override
+    {
+        return stream_->prepare (std::move (resume));
+    }
+    std::vector<boost::asio::const_buffer> data () override
+    {
+        return stream_->data ();
+    }
+};
+HTTPChunkedReply::HTTPChunkedReply (int nStatus,
+    std::function<void(void)> suspend, std::function<void(void)> resume)
+    : stream_ (std::make_shared<Stream> (std::move (resume)))
+    , suspend_ (std::move (suspend))
+{
+    writeStatusLine (nStatus, output ());
+    write (getHTTPHeaderTimestamp ());
+    write ("Connection: Keep-Alive\r\n"
+           "Transfer-Encoding: chunked\r\n");
+    writeServerHeaders (output ());
+    std::string headers;
+    std::swap (headers, buffer_);
+    send (std::move (headers), false);
+    size_ = 0;
+    buffer_.reserve (chunkSize);
+}
+HTTPChunkedReply::~HTTPChunkedReply ()
+{
+    if (! finished_)
+        abort ();
+}
+std::shared_ptr<Writer> HTTPChunkedReply::writer () const
+{
+    return std::make_shared<StreamWriter> (stream_);
+}
+void HTTPChunkedReply::write (boost::beast::string_view const& data)
+{
+    if (finished_)
+        return;
+    size_ += data.size ();
+    buffer_.append (data.data (), data.size ());
+    if (buffer_.size () >= chunkSize && ! boost::core::uncaught_exceptions ())
+        flush ();
+}
+Json::Output HTTPChunkedReply::output ()
+{
+    return [this](boost::beast::string_view const& data)
+    {
+        write (data);
+    };
+}
+void HTTPChunkedReply::finish ()
+{
+    if (finished_)
+        return;
+    flush ();
+    send ("0\r\n\r\n", true);
+    finished_ = true;
+}
+void HTTPChunkedReply::abort ()
+{
+    finished_ = true;
+    stream_->abort ();
+}
+bool HTTPChunkedReply::closed () const
+{
+    return stream_->isClosed ();
+}
+void HTTPChunkedReply::flush ()
+{
+    if (buffer_.empty ())
+        return;
+    std::stringstream ss;
+    ss << std::hex << buffer_.size () << "\r\n";
+    std::string chunk = ss.str ();
+    chunk.reserve (chunk.size () + buffer_.size () + 2);
+    chunk += buffer_;
+    chunk += "\r\n";
+    buffer_.clear ();
+    send (std::move (chunk), false);
+}
+void HTTPChunkedReply::send (std::string&& data, bool last)
+{
+    if (stream_->push (std::move (data), last))
+    {
+        while (stream_->wait ())
+            suspend_ ();
+        if (! stream_->isClosed ())
+            return;
+    }
+    abort ();
+    Throw<std::runtime_error> ("HTTP client closed the connection");
+}
 } 
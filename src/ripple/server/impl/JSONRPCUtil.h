@@ -2,8 +2,44 @@
 #define RIPPLE_SERVER_JSONRPCUTIL_H_INCLUDED
 #include <ripple/json/json_value.h>
 #include <ripple/json/Output.h>
+#include <ripple/beast/utility/Journal.h>
+#include <ripple/server/Writer.h>
+#include <functional>
+#include <memory>
+#include <string>
 namespace ripple {
 void HTTPReply (
     int nStatus, std::string const& strMsg, Json::Output const&, beast::Journal j);
+class HTTPChunkedReply
+{
+public:
+    static std::size_t constexpr chunkSize = 16 * 1024;
+    static std::size_t constexpr maxQueued = 4 * chunkSize;
+    HTTPChunkedReply (int nStatus,
+        std::function<void(void)> suspend, std::function<void(void)> resume);
+    ~HTTPChunkedReply ();
+    HTTPChunkedReply (HTTPChunkedReply const&) = delete;
+    HTTPChunkedReply& operator= (HTTPChunkedReply const&) = delete;
+    std::shared_ptr<Writer> writer () const;
+    void write (boost::beast::string_view const& data);
+    Json::Output output ();
+    void finish ();
+    void abort ();
+    bool closed () const;
+    std::size_t size () const
+    {
+        return size_;
+    }
+private:
+    class Stream;
+    class StreamWriter;
+    void flush ();
+    void send (std::string&& data, bool last);
+    std::shared_ptr<Stream> stream_;
+    std::function<void(void)> suspend_;
+    std::string buffer_;
+    std::size_t size_ = 0;
+    bool finished_ = false;
+};
 } 
 #endif
@@ -6,6 +6,7 @@
 #include <ripple/nodestore/Database.h>
 #include <ripple/beast/utility/Journal.h>
 #include <cstdint>
+#include <functional>
 namespace ripple {
 class Family
 {
@@ -36,6 +37,12 @@ public:
     bool
     isShardBacked() const = 0;
     virtual
+    std::size_t
+    flushThreads() const = 0;
+    virtual
+    void
+    addFlushJob (std::function<void()> job) = 0;
+    virtual
     void
     missing_node (std::uint32_t refNum) = 0;
     virtual
@@ -101,18 +101,22 @@ public:
     const_iterator upper_bound(uint256 const& id) const;
     void visitNodes (std::function<bool (
         SHAMapAbstractNode&)> const& function) const;
+    bool visitBranch (int branch, std::function<bool (
+        SHAMapAbstractNode&)> const& function) const;
     void visitDifferences(SHAMap const* have,
         std::function<bool (SHAMapAbstractNode&)>) const;
     void visitLeaves(std::function<void (
         std::shared_ptr<SHAMapItem const> const&)> const&) const;
     std::vector<std::pair<SHAMapNodeID, uint256>>
-    getMissingNodes (int maxNodes, SHAMapSyncFilter *filter);
+    getMissingNodes (int maxNodes, SHAMapSyncFilter *filter,
+        NodeStore::ReadPriority priority = NodeStore::ReadPriority::critical);
     bool getNodeFat (SHAMapNodeID node,
         std::vector<SHAMapNodeID>& nodeIDs,
             std::vector<Blob>& rawNode,
                 bool fatLeaves, std::uint32_t depth) const;
     bool getRootNode (Serializer & s, SHANodeFormat format) const;
-    std::vector<uint256> getNeededHashes (int max, SHAMapSyncFilter * filter);
+    std::vector<uint256> getNeededHashes (int max, SHAMapSyncFilter * filter,
+        NodeStore::ReadPriority priority = NodeStore::ReadPriority::critical);
     SHAMapAddNode addRootNode (SHAMapHash const& hash, Slice const& rootNode,
                                SHANodeFormat format, SHAMapSyncFilter * filter);
     SHAMapAddNode addKnownNode (SHAMapNodeID const& nodeID, Slice const& rawNode,
@@ -146,6 +150,8 @@ private:
     std::shared_ptr<SHAMapAbstractNode> getCache (SHAMapHash const& hash) const;
     void canonicalize (SHAMapHash const& hash, std::shared_ptr<SHAMapAbstractNode>&) const;
     std::shared_ptr<SHAMapAbstractNode> fetchNodeFromDB (SHAMapHash const& hash) const;
+    std::shared_ptr<SHAMapAbstractNode> finishFetch (SHAMapHash const& hash,
+        std::shared_ptr<NodeObject> const& obj) const;
     std::shared_ptr<SHAMapAbstractNode> fetchNodeNT (SHAMapHash const& hash) const;
     std::shared_ptr<SHAMapAbstractNode> fetchNodeNT (
         SHAMapHash const& hash,
@@ -168,14 +174,17 @@ private:
     std::shared_ptr<SHAMapAbstractNode>
         writeNode(NodeObjectType t, std::uint32_t seq,
                   std::shared_ptr<SHAMapAbstractNode> node) const;
+    std::shared_ptr<SHAMapAbstractNode>
+        writeNode(NodeObjectType t, std::uint32_t seq,
+                  std::shared_ptr<SHAMapAbstractNode> node, Blob&& data) const;
     SHAMapTreeNode* firstBelow (std::shared_ptr<SHAMapAbstractNode>,
                                 SharedPtrNodeStack& stack, int branch = 0) const;
     SHAMapAbstractNode* descend (SHAMapInnerNode*, int branch) const;
     SHAMapAbstractNode* descendThrow (SHAMapInnerNode*, int branch) const;
     std::shared_ptr<SHAMapAbstractNode> descend (std::shared_ptr<SHAMapInnerNode> const&, int branch) const;
     std::shared_ptr<SHAMapAbstractNode> descendThrow (std::shared_ptr<SHAMapInnerNode> const&, int branch) const;
-    SHAMapAbstractNode* descendAsync (SHAMapInnerNode* parent, int branch,
-        SHAMapSyncFilter* filter, bool& pending) const;
+    void fetchChildren (SHAMapInnerNode* parent, SHAMapNodeID const& parentID,
+        SHAMap const* have) const;
     std::pair <SHAMapAbstractNode*, SHAMapNodeID>
         descend (SHAMapInnerNode* parent, SHAMapNodeID const& parentID,
         int branch, SHAMapSyncFilter* filter) const;
@@ -190,6 +199,13 @@ private:
                      std::shared_ptr<SHAMapItem const> const& otherMapItem,
                      bool isFirstMap, Delta & differences, int & maxCount) const;
     int walkSubTree (bool doWrite, NodeObjectType t, std::uint32_t seq);
+    int walkBranches (std::shared_ptr<SHAMapInnerNode>& node,
+                      bool doWrite, NodeObjectType t, std::uint32_t seq) const;
+    int flushChildren (SHAMapInnerNode& node,
+                       bool doWrite, NodeObjectType t, std::uint32_t seq) const;
+    int walkBranchesParallel (std::shared_ptr<SHAMapInnerNode>& node,
+                              std::size_t threads, bool doWrite,
+                              NodeObjectType t, std::uint32_t seq) const;
     bool isInconsistentNode(std::shared_ptr<SHAMapAbstractNode> const& node) const;
     struct MissingNodes
     {
@@ -200,6 +216,8 @@ private:
         SHAMapSyncFilter* filter_;
         int const         maxDefer_;
         std::uint32_t     generation_;
+        bool const        batch_;
+        NodeStore::ReadPriority const priority_;
         std::vector<std::pair<SHAMapNodeID, uint256>> missingNodes_;
         std::set <SHAMapHash>                         missingHashes_;
         using StackEntry = std::tuple<
@@ -213,14 +231,18 @@ private:
         std::map<SHAMapInnerNode*, SHAMapNodeID> resumes_;
         MissingNodes (
             int max, SHAMapSyncFilter* filter,
-            int maxDefer, std::uint32_t generation) :
+            int maxDefer, std::uint32_t generation, bool batch,
+            NodeStore::ReadPriority priority) :
                 max_(max), filter_(filter),
-                maxDefer_(maxDefer), generation_(generation)
+                maxDefer_(maxDefer), generation_(generation), batch_(batch),
+                priority_(priority)
         {
             missingNodes_.reserve (max);
             deferredReads_.reserve(maxDefer);
         }
     };
+    SHAMapAbstractNode* descendAsync (SHAMapInnerNode* parent, int branch,
+        MissingNodes const& mn, bool& pending) const;
     void gmn_ProcessNodes (MissingNodes&, MissingNodes::StackEntry& node);
     void gmn_ProcessDeferredReads (MissingNodes&);
 };
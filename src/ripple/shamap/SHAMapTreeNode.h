@@ -4,10 +4,13 @@
 #include <ripple/shamap/SHAMapNodeID.h>
 #include <ripple/basics/TaggedCache.h>
 #include <ripple/beast/utility/Journal.h>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
+#include <vector>
 namespace ripple {
 enum SHANodeFormat
 {
@@ -95,16 +98,24 @@ public:
         make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat format,
              SHAMapHash const& hash, bool hashValid, beast::Journal j,
              SHAMapNodeID const& id = SHAMapNodeID{});
+    static void updateHashes (
+        std::vector<std::shared_ptr<SHAMapAbstractNode>> const& nodes,
+        std::vector<Serializer>& raw);
 };
 class SHAMapInnerNodeV2;
 class SHAMapInnerNode
     : public SHAMapAbstractNode
 {
-    std::array<SHAMapHash, 16>          mHashes;
-    std::shared_ptr<SHAMapAbstractNode> mChildren[16];
-    int                             mIsBranch = 0;
+    class ChildLock;
+    std::unique_ptr<SHAMapHash[]>                          mHashes;
+    std::unique_ptr<std::shared_ptr<SHAMapAbstractNode>[]> mChildren;
+    std::uint16_t                   mIsBranch = 0;
+    mutable std::atomic<std::uint16_t> mChildLock {0};
     std::uint32_t                   mFullBelowGen = 0;
-    static std::mutex               childLock;
+    static SHAMapHash const         emptyHash;
+    int branchIndex (int m) const;
+    void setBranches (std::uint16_t isBranch);
+    void setHashes (std::array<SHAMapHash, 16> const& hashes);
 public:
     SHAMapInnerNode(std::uint32_t seq);
     std::shared_ptr<SHAMapAbstractNode> clone(std::uint32_t seq) const override;
@@ -122,6 +133,7 @@ public:
     void setFullBelowGen (std::uint32_t gen);
     bool updateHash () override;
     void updateHashDeep();
+    void updateChildHashes();
     void addRaw (Serializer&, SHANodeFormat format) const override;
     std::string getString (SHAMapNodeID const&) const override;
     uint256 const& key() const override;
@@ -259,11 +271,19 @@ SHAMapInnerNode::isEmptyBranch (int m) const
     return (mIsBranch & (1 << m)) == 0;
 }
 inline
+int
+SHAMapInnerNode::branchIndex (int m) const
+{
+    return std::bitset<16> (mIsBranch & ((1 << m) - 1)).count ();
+}
+inline
 SHAMapHash const&
 SHAMapInnerNode::getChildHash (int m) const
 {
     assert ((m >= 0) && (m < 16) && (getType() == tnINNER));
-    return mHashes[m];
+    if (isEmptyBranch (m))
+        return emptyHash;
+    return mHashes[branchIndex (m)];
 }
 inline
 bool
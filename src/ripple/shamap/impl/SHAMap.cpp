@@ -1,6 +1,10 @@
 
 #include <ripple/basics/contract.h>
 #include <ripple/shamap/SHAMap.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 namespace ripple {
 SHAMap::SHAMap (
     SHAMapType t,
@@ -195,52 +199,57 @@ SHAMap::findKey(uint256 const& id) const
 }
 std::shared_ptr<SHAMapAbstractNode>
 SHAMap::fetchNodeFromDB (SHAMapHash const& hash) const
+{
+    if (! backed_)
+        return {};
+    return finishFetch (hash, f_.db().fetch(hash.as_uint256(), ledgerSeq_));
+}
+std::shared_ptr<SHAMapAbstractNode>
+SHAMap::finishFetch (SHAMapHash const& hash,
+    std::shared_ptr<NodeObject> const& obj) const
 {
     std::shared_ptr<SHAMapAbstractNode> node;
-    if (backed_)
+    if (obj)
     {
-        if (auto obj = f_.db().fetch(hash.as_uint256(), ledgerSeq_))
+        try
         {
-            try
+            node = SHAMapAbstractNode::make(makeSlice(obj->getData()),
+                0, snfPREFIX, hash, true, f_.journal());
+            if (node && node->isInner())
             {
-                node = SHAMapAbstractNode::make(makeSlice(obj->getData()),
-                    0, snfPREFIX, hash, true, f_.journal());
-                if (node && node->isInner())
+                bool isv2 = std::dynamic_pointer_cast<SHAMapInnerNodeV2>(node) != nullptr;
+                if (isv2 != is_v2())
                 {
-                    bool isv2 = std::dynamic_pointer_cast<SHAMapInnerNodeV2>(node) != nullptr;
-                    if (isv2 != is_v2())
+                    auto root =  std::dynamic_pointer_cast<SHAMapInnerNode>(root_);
+                    assert(root);
+                    assert(root->isEmpty());
+                    if (isv2)
                     {
-                        auto root =  std::dynamic_pointer_cast<SHAMapInnerNode>(root_);
-                        assert(root);
-                        assert(root->isEmpty());
-                        if (isv2)
-                        {
-                            auto temp = make_v2();
-                            swap(temp->root_, const_cast<std::shared_ptr<SHAMapAbstractNode>&>(root_));
-                        }
-                        else
-                        {
-                            auto temp = make_v1();
-                            swap(temp->root_, const_cast<std::shared_ptr<SHAMapAbstractNode>&>(root_));
-                        }
+                        auto temp = make_v2();
+                        swap(temp->root_, const_cast<std::shared_ptr<SHAMapAbstractNode>&>(root_));
+                    }
+                    else
+                    {
+                        auto temp = make_v1();
+                        swap(temp->root_, const_cast<std::shared_ptr<SHAMapAbstractNode>&>(root_));
                     }
                 }
-                if (node)
-                    canonicalize (hash, node);
-            }
-            catch (std::exception const&)
-            {
-                JLOG(journal_.warn()) <<
-                    "Invalid DB node " << hash;
-                return std::shared_ptr<SHAMapTreeNode> ();
             }
+            if (node)
+                canonicalize (hash, node);
         }
-        else if (full_)
+        catch (std::exception const&)
         {
-            f_.missing_node(ledgerSeq_);
-            const_cast<bool&>(full_) = false;
+            JLOG(journal_.warn()) <<
+                "Invalid DB node " << hash;
+            return std::shared_ptr<SHAMapTreeNode> ();
         }
     }
+    else if (full_)
+    {
+        f_.missing_node(ledgerSeq_);
+        const_cast<bool&>(full_) = false;
+    }
     return node;
 }
 std::shared_ptr<SHAMapAbstractNode>
@@ -375,7 +384,7 @@ SHAMap::descend (SHAMapInnerNode * parent, SHAMapNodeID const& parentID,
 }
 SHAMapAbstractNode*
 SHAMap::descendAsync (SHAMapInnerNode* parent, int branch,
-    SHAMapSyncFilter * filter, bool & pending) const
+    MissingNodes const& mn, bool & pending) const
 {
     pending = false;
     SHAMapAbstractNode* ret = parent->getChildPointer (branch);
@@ -385,12 +394,18 @@ SHAMap::descendAsync (SHAMapInnerNode* parent, int branch,
     std::shared_ptr<SHAMapAbstractNode> ptr = getCache (hash);
     if (!ptr)
     {
-        if (filter)
-            ptr = checkFilter (hash, filter);
+        if (mn.filter_)
+            ptr = checkFilter (hash, mn.filter_);
         if (!ptr && backed_)
         {
+            if (mn.batch_)
+            {
+                pending = true;
+                return nullptr;
+            }
             std::shared_ptr<NodeObject> obj;
-            if (! f_.db().asyncFetch (hash.as_uint256(), ledgerSeq_, obj))
+            if (! f_.db().asyncFetch (hash.as_uint256(), ledgerSeq_, obj,
+                mn.priority_))
             {
                 pending = true;
                 return nullptr;
@@ -409,6 +424,43 @@ SHAMap::descendAsync (SHAMapInnerNode* parent, int branch,
         ptr = parent->canonicalizeChild (branch, std::move(ptr));
     return ptr.get ();
 }
+void
+SHAMap::fetchChildren (SHAMapInnerNode* parent, SHAMapNodeID const& parentID,
+    SHAMap const* have) const
+{
+    if (! backed_ || ! f_.db().canFetchBatch ())
+        return;
+    std::vector<int> branches;
+    std::vector<uint256> hashes;
+    for (int branch = 0; branch < 16; ++branch)
+    {
+        if (parent->isEmptyBranch (branch) || parent->getChildPointer (branch))
+            continue;
+        auto const& childHash = parent->getChildHash (branch);
+        if (have && have->hasInnerNode (
+                parentID.getChildNodeID (branch), childHash))
+            continue;
+        if (auto node = getCache (childHash))
+        {
+            if (! isInconsistentNode (node))
+                parent->canonicalizeChild (branch, std::move (node));
+            continue;
+        }
+        branches.push_back (branch);
+        hashes.push_back (childHash.as_uint256 ());
+    }
+    if (hashes.size () < 2)
+        return;
+    auto const objs = f_.db().fetchBatch (hashes, ledgerSeq_);
+    for (std::size_t i = 0; i < objs.size (); ++i)
+    {
+        if (! objs[i])
+            continue;
+        auto node = finishFetch (SHAMapHash{hashes[i]}, objs[i]);
+        if (node && ! isInconsistentNode (node))
+            parent->canonicalizeChild (branches[i], std::move (node));
+    }
+}
 template <class Node>
 std::shared_ptr<Node>
 SHAMap::unshareNode (std::shared_ptr<Node> node, SHAMapNodeID const& nodeID)
@@ -910,14 +962,20 @@ bool SHAMap::fetchRoot (SHAMapHash const& hash, SHAMapSyncFilter* filter)
 std::shared_ptr<SHAMapAbstractNode>
 SHAMap::writeNode (
     NodeObjectType t, std::uint32_t seq, std::shared_ptr<SHAMapAbstractNode> node) const
+{
+    Serializer s;
+    node->addRaw (s, snfPREFIX);
+    return writeNode (t, seq, std::move (node), std::move (s.modData ()));
+}
+std::shared_ptr<SHAMapAbstractNode>
+SHAMap::writeNode (NodeObjectType t, std::uint32_t seq,
+    std::shared_ptr<SHAMapAbstractNode> node, Blob&& data) const
 {
     assert (node->getSeq() == seq_);
     assert (backed_);
     node->setSeq (0);
     canonicalize (node->getNodeHash(), node);
-    Serializer s;
-    node->addRaw (s, snfPREFIX);
-    f_.db().store (t, std::move (s.modData ()),
+    f_.db().store (t, std::move (data),
         node->getNodeHash ().as_uint256(), ledgerSeq_);
     return node;
 }
@@ -944,10 +1002,8 @@ int SHAMap::flushDirty (NodeObjectType t, std::uint32_t seq)
 int
 SHAMap::walkSubTree (bool doWrite, NodeObjectType t, std::uint32_t seq)
 {
-    int flushed = 0;
-    Serializer s;
     if (!root_ || (root_->getSeq() == 0))
-        return flushed;
+        return 0;
     if (root_->isLeaf())
     { 
         root_ = preFlushNode (std::move(root_));
@@ -967,9 +1023,21 @@ SHAMap::walkSubTree (bool doWrite, NodeObjectType t, std::uint32_t seq)
             root_ = std::make_shared<SHAMapInnerNode>(0);
         return 1;
     }
+    node = preFlushNode(std::move(node));
+    auto const threads = f_.flushThreads();
+    int const flushed = (doWrite && threads > 1)
+        ? walkBranchesParallel (node, threads, doWrite, t, seq)
+        : walkBranches (node, doWrite, t, seq);
+    root_ = std::move (node);
+    return flushed;
+}
+int
+SHAMap::walkBranches (std::shared_ptr<SHAMapInnerNode>& node,
+    bool doWrite, NodeObjectType t, std::uint32_t seq) const
+{
+    int flushed = 0;
     using StackEntry = std::pair <std::shared_ptr<SHAMapInnerNode>, int>;
     std::stack <StackEntry, std::vector<StackEntry>> stack;
-    node = preFlushNode(std::move(node));
     int pos = 0;
     while (1)
     {
@@ -994,25 +1062,13 @@ SHAMap::walkSubTree (bool doWrite, NodeObjectType t, std::uint32_t seq)
                     }
                     else
                     {
-                        ++flushed;
                         assert (node->getSeq() == seq_);
-                        child->updateHash();
-                        if (doWrite && backed_)
-                            child = writeNode(t, seq, std::move(child));
-                        else
-                            child->setSeq (0);
                         node->shareChild (branch, child);
                     }
                 }
             }
         }
-        node->updateHashDeep();
-        if (doWrite && backed_)
-            node = std::static_pointer_cast<SHAMapInnerNode>(writeNode(t, seq,
-                                                                       std::move(node)));
-        else
-            node->setSeq (0);
-        ++flushed;
+        flushed += flushChildren (*node, doWrite, t, seq);
         if (stack.empty ())
            break;
         auto parent = std::move (stack.top().first);
@@ -1023,8 +1079,121 @@ SHAMap::walkSubTree (bool doWrite, NodeObjectType t, std::uint32_t seq)
         node = std::move (parent);
         ++pos;
     }
-    root_ = std::move (node);
-    return flushed;
+    node->updateHashDeep();
+    if (doWrite && backed_)
+        node = std::static_pointer_cast<SHAMapInnerNode>(writeNode(t, seq,
+                                                                   std::move(node)));
+    else
+        node->setSeq (0);
+    return flushed + 1;
+}
+int
+SHAMap::flushChildren (SHAMapInnerNode& node,
+    bool doWrite, NodeObjectType t, std::uint32_t seq) const
+{
+    std::vector<int> branches;
+    std::vector<std::shared_ptr<SHAMapAbstractNode>> children;
+    for (int branch = 0; branch < 16; ++branch)
+    {
+        if (node.isEmptyBranch (branch))
+            continue;
+        auto child = node.getChild (branch);
+        if (child && (child->getSeq () != 0))
+        {
+            assert (child->getSeq () == seq_);
+            branches.push_back (branch);
+            children.push_back (std::move (child));
+        }
+    }
+    if (children.empty ())
+        return 0;
+    std::vector<Serializer> raw;
+    SHAMapAbstractNode::updateHashes (children, raw);
+    for (std::size_t i = 0; i < children.size (); ++i)
+    {
+        auto& child = children[i];
+        if (doWrite && backed_ && raw[i].size () != 0)
+            child = writeNode (t, seq, std::move (child),
+                std::move (raw[i].modData ()));
+        else
+            child->setSeq (0);
+        node.shareChild (branches[i], child);
+    }
+    return children.size ();
+}
+int
+SHAMap::walkBranchesParallel (std::shared_ptr<SHAMapInnerNode>& node,
+    std::size_t threads, bool doWrite, NodeObjectType t, std::uint32_t seq) const
+{
+    std::vector<std::pair<int, std::shared_ptr<SHAMapInnerNode>>> subtrees;
+    for (int branch = 0; branch < 16; ++branch)
+    {
+        if (node->isEmptyBranch (branch))
+            continue;
+        auto child = node->getChild (branch);
+        if (child && child->isInner () && (child->getSeq () != 0))
+        {
+            child = preFlushNode (std::move (child));
+            node->shareChild (branch, child);
+            subtrees.emplace_back (branch,
+                std::static_pointer_cast<SHAMapInnerNode>(std::move (child)));
+        }
+    }
+    if (subtrees.size () < 2)
+        return walkBranches (node, doWrite, t, seq);
+    struct State
+    {
+        std::function<int (std::size_t)> work;
+        std::size_t count;
+        std::atomic<std::size_t> next {0};
+        std::size_t done = 0;
+        int flushed = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable cv;
+        void run ()
+        {
+            for (auto i = next++; i < count; i = next++)
+            {
+                int n = 0;
+                std::exception_ptr e;
+                try
+                {
+                    n = work (i);
+                }
+                catch (...)
+                {
+                    e = std::current_exception ();
+                }
+                std::lock_guard<std::mutex> lock (mutex);
+                flushed += n;
+                if (e && ! error)
+                    error = e;
+                if (++done == count)
+                    cv.notify_all ();
+            }
+        }
+    };
+    auto state = std::make_shared<State> ();
+    state->work = [&](std::size_t i)
+    {
+        return walkBranches (subtrees[i].second, doWrite, t, seq);
+    };
+    state->count = subtrees.size ();
+    auto const helpers = std::min (threads, subtrees.size ()) - 1;
+    for (std::size_t i = 0; i < helpers; ++i)
+        f_.addFlushJob ([state] { state->run (); });
+    state->run ();
+    {
+        std::unique_lock<std::mutex> lock (state->mutex);
+        state->cv.wait (lock,
+            [&state] { return state->done == state->count; });
+    }
+    if (state->error)
+        std::rethrow_exception (state->error);
+    for (auto& subtree : subtrees)
+        node->shareChild (subtree.first, subtree.second);
+    return state->flushed + walkBranches (node, doWrite, t, seq);
 }
 void SHAMap::dump (bool hash) const
 {
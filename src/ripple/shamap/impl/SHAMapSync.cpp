@@ -25,20 +25,39 @@ SHAMap::visitNodes(std::function<bool (
     function (*root_);
     if (! root_->isInner ())
         return;
+    for (int branch = 0; branch < 16; ++branch)
+    {
+        if (! visitBranch (branch, function))
+            return;
+    }
+}
+bool
+SHAMap::visitBranch(int branch, std::function<bool (
+    SHAMapAbstractNode&)> const& function) const
+{
+    if (! root_ || ! root_->isInner ())
+        return true;
+    auto node = std::static_pointer_cast<SHAMapInnerNode>(root_);
+    if (node->isEmptyBranch (branch))
+        return true;
+    std::shared_ptr<SHAMapAbstractNode> top = descendNoStore (node, branch);
+    if (! function (*top))
+        return false;
+    if (top->isLeaf ())
+        return true;
     using StackEntry = std::pair <int, std::shared_ptr<SHAMapInnerNode>>;
     std::stack <StackEntry, std::vector <StackEntry>> stack;
-    auto node = std::static_pointer_cast<SHAMapInnerNode>(root_);
+    node = std::static_pointer_cast<SHAMapInnerNode>(top);
     int pos = 0;
     while (1)
     {
         while (pos < 16)
         {
-            uint256 childHash;
             if (! node->isEmptyBranch (pos))
             {
                 std::shared_ptr<SHAMapAbstractNode> child = descendNoStore (node, pos);
                 if (! function (*child))
-                    return;
+                    return false;
                 if (child->isLeaf ())
                     ++pos;
                 else
@@ -63,6 +82,7 @@ SHAMap::visitNodes(std::function<bool (
         std::tie(pos, node) = stack.top ();
         stack.pop ();
     }
+    return true;
 }
 void
 SHAMap::visitDifferences(SHAMap const* have,
@@ -93,18 +113,18 @@ SHAMap::visitDifferences(SHAMap const* have,
         stack.pop ();
         if (! function (*node))
             return;
+        fetchChildren (node, nodeID, have);
         for (int i = 0; i < 16; ++i)
         {
             if (! node->isEmptyBranch (i))
             {
                 auto const& childHash = node->getChildHash (i);
                 SHAMapNodeID childID = nodeID.getChildNodeID (i);
+                if (have && have->hasInnerNode(childID, childHash))
+                    continue;
                 auto next = descendThrow(node, i);
                 if (next->isInner ())
-                {
-                    if (! have || ! have->hasInnerNode(childID, childHash))
-                        stack.push ({static_cast<SHAMapInnerNode*>(next), childID});
-                }
+                    stack.push ({static_cast<SHAMapInnerNode*>(next), childID});
                 else if (! have || ! have->hasLeafNode(
                          static_cast<SHAMapTreeNode*>(next)->peekItem()->key(),
                          childHash))
@@ -137,7 +157,7 @@ void SHAMap::gmn_ProcessNodes (MissingNodes& mn, MissingNodes::StackEntry& se)
         {
             SHAMapNodeID childID = nodeID.getChildNodeID (branch);
             bool pending = false;
-            auto d = descendAsync (node, branch, mn.filter_, pending);
+            auto d = descendAsync (node, branch, mn, pending);
             if (!d)
             {
                 fullBelow = false; 
@@ -178,19 +198,39 @@ void SHAMap::gmn_ProcessNodes (MissingNodes& mn, MissingNodes::StackEntry& se)
 void SHAMap::gmn_ProcessDeferredReads (MissingNodes& mn)
 {
     auto const before = std::chrono::steady_clock::now();
-    f_.db().waitReads();
+    std::vector<std::shared_ptr<NodeObject>> objs;
+    if (mn.batch_)
+    {
+        std::vector<uint256> hashes;
+        hashes.reserve (mn.deferredReads_.size ());
+        for (auto const& deferredNode : mn.deferredReads_)
+            hashes.push_back (std::get<0>(deferredNode)->getChildHash (
+                std::get<2>(deferredNode)).as_uint256 ());
+        objs = f_.db().fetchBatch (hashes, ledgerSeq_);
+    }
+    else
+        f_.db().waitReads(mn.priority_);
     auto const after = std::chrono::steady_clock::now();
     auto const elapsed = std::chrono::duration_cast
         <std::chrono::milliseconds> (after - before);
     auto const count = mn.deferredReads_.size ();
     int hits = 0;
-    for (auto const& deferredNode : mn.deferredReads_)
+    for (std::size_t i = 0; i < count; ++i)
     {
+        auto const& deferredNode = mn.deferredReads_[i];
         auto parent = std::get<0>(deferredNode);
         auto const& parentID = std::get<1>(deferredNode);
         auto branch = std::get<2>(deferredNode);
         auto const& nodeHash = parent->getChildHash (branch);
-        auto nodePtr = fetchNodeNT(nodeHash, mn.filter_);
+        std::shared_ptr<SHAMapAbstractNode> nodePtr;
+        if (mn.batch_)
+        {
+            nodePtr = finishFetch (nodeHash, objs[i]);
+            if (! nodePtr && mn.filter_)
+                nodePtr = checkFilter (nodeHash, mn.filter_);
+        }
+        else
+            nodePtr = fetchNodeNT(nodeHash, mn.filter_);
         if (nodePtr)
         { 
             ++hits;
@@ -221,14 +261,17 @@ void SHAMap::gmn_ProcessDeferredReads (MissingNodes& mn)
 }
 
 std::vector<std::pair<SHAMapNodeID, uint256>>
-SHAMap::getMissingNodes(int max, SHAMapSyncFilter* filter)
+SHAMap::getMissingNodes(int max, SHAMapSyncFilter* filter,
+    NodeStore::ReadPriority priority)
 {
     assert (root_->isValid ());
     assert (root_->getNodeHash().isNonZero ());
     assert (max > 0);
     MissingNodes mn (max, filter,
         f_.db().getDesiredAsyncReadCount(ledgerSeq_),
-        f_.fullbelow().getGeneration());
+        f_.fullbelow().getGeneration(),
+        backed_ && f_.db().canFetchBatch(),
+        priority);
     if (! root_->isInner () ||
             std::static_pointer_cast<SHAMapInnerNode>(root_)->
                 isFullBelow (mn.generation_))
@@ -292,9 +335,10 @@ SHAMap::getMissingNodes(int max, SHAMapSyncFilter* filter)
         clearSynching ();
     return std::move(mn.missingNodes_);
 }
-std::vector<uint256> SHAMap::getNeededHashes (int max, SHAMapSyncFilter* filter)
+std::vector<uint256> SHAMap::getNeededHashes (int max, SHAMapSyncFilter* filter,
+    NodeStore::ReadPriority priority)
 {
-    auto ret = getMissingNodes(max, filter);
+    auto ret = getMissingNodes(max, filter, priority);
     std::vector<uint256> hashes;
     hashes.reserve (ret.size());
     for (auto const& n : ret)
@@ -7,22 +7,55 @@
 #include <ripple/basics/StringUtilities.h>
 #include <ripple/protocol/HashPrefix.h>
 #include <ripple/beast/core/LexicalCast.h>
-#include <mutex>
 #include <openssl/sha.h>
+#include <thread>
 namespace ripple {
-std::mutex SHAMapInnerNode::childLock;
+SHAMapHash const SHAMapInnerNode::emptyHash;
+class SHAMapInnerNode::ChildLock
+{
+    std::atomic<std::uint16_t>& lock_;
+    std::uint16_t const mask_;
+public:
+    ChildLock (SHAMapInnerNode const& node, std::uint16_t mask)
+        : lock_ (node.mChildLock)
+        , mask_ (mask)
+    {
+        auto bits = lock_.load (std::memory_order_relaxed);
+        for (;;)
+        {
+            if (bits & mask_)
+            {
+                std::this_thread::yield ();
+                bits = lock_.load (std::memory_order_relaxed);
+            }
+            else if (lock_.compare_exchange_weak (bits, bits | mask_,
+                std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+    }
+    ChildLock (ChildLock const&) = delete;
+    ChildLock& operator= (ChildLock const&) = delete;
+    ~ChildLock ()
+    {
+        lock_.fetch_and (static_cast<std::uint16_t> (~mask_),
+            std::memory_order_release);
+    }
+};
 SHAMapAbstractNode::~SHAMapAbstractNode() = default;
 std::shared_ptr<SHAMapAbstractNode>
 SHAMapInnerNode::clone(std::uint32_t seq) const
 {
     auto p = std::make_shared<SHAMapInnerNode>(seq);
     p->mHash = mHash;
-    p->mIsBranch = mIsBranch;
     p->mFullBelowGen = mFullBelowGen;
-    p->mHashes = mHashes;
-    std::lock_guard <std::mutex> lock(childLock);
-    for (int i = 0; i < 16; ++i)
+    p->setBranches (mIsBranch);
+    auto const count = getBranchCount ();
+    ChildLock lock (*this, mIsBranch);
+    for (int i = 0; i < count; ++i)
     {
+        p->mHashes[i] = mHashes[i];
         p->mChildren[i] = mChildren[i];
         assert(std::dynamic_pointer_cast<SHAMapInnerNodeV2>(p->mChildren[i]) == nullptr);
     }
@@ -33,14 +66,15 @@ SHAMapInnerNodeV2::clone(std::uint32_t seq) const
 {
     auto p = std::make_shared<SHAMapInnerNodeV2>(seq);
     p->mHash = mHash;
-    p->mIsBranch = mIsBranch;
     p->mFullBelowGen = mFullBelowGen;
-    p->mHashes = mHashes;
+    p->setBranches (mIsBranch);
     p->common_ = common_;
     p->depth_ = depth_;
-    std::lock_guard <std::mutex> lock(childLock);
-    for (int i = 0; i < 16; ++i)
+    auto const count = getBranchCount ();
+    ChildLock lock (*this, mIsBranch);
+    for (int i = 0; i < count; ++i)
     {
+        p->mHashes[i] = mHashes[i];
         p->mChildren[i] = mChildren[i];
         if (p->mChildren[i] != nullptr)
             assert(std::dynamic_pointer_cast<SHAMapInnerNodeV2>(p->mChildren[i]) != nullptr ||
@@ -110,12 +144,10 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
             if (len != 512)
                 Throw<std::runtime_error> ("invalid FI node");
             auto ret = std::make_shared<SHAMapInnerNode>(seq);
+            std::array<SHAMapHash, 16> hashes;
             for (int i = 0; i < 16; ++i)
-            {
-                s.get256 (ret->mHashes[i].as_uint256(), i * 32);
-                if (ret->mHashes[i].isNonZero ())
-                    ret->mIsBranch |= (1 << i);
-            }
+                s.get256 (hashes[i].as_uint256(), i * 32);
+            ret->setHashes (hashes);
             if (hashValid)
                 ret->mHash = hash;
             else
@@ -125,6 +157,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
         else if (type == 3)
         {
             auto ret = std::make_shared<SHAMapInnerNode>(seq);
+            std::array<SHAMapHash, 16> hashes;
             for (int i = 0; i < (len / 33); ++i)
             {
                 int pos;
@@ -132,10 +165,9 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
                     Throw<std::runtime_error> ("short CI node");
                 if ((pos < 0) || (pos >= 16))
                     Throw<std::runtime_error> ("invalid CI node");
-                s.get256 (ret->mHashes[pos].as_uint256(), i * 33);
-                if (ret->mHashes[pos].isNonZero ())
-                    ret->mIsBranch |= (1 << pos);
+                s.get256 (hashes[pos].as_uint256(), i * 33);
             }
+            ret->setHashes (hashes);
             if (hashValid)
                 ret->mHash = hash;
             else
@@ -161,12 +193,10 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
             if (len != 512)
                 Throw<std::runtime_error> ("invalid FI node");
             auto ret = std::make_shared<SHAMapInnerNodeV2>(seq);
+            std::array<SHAMapHash, 16> hashes;
             for (int i = 0; i < 16; ++i)
-            {
-                s.get256 (ret->mHashes[i].as_uint256(), i * 32);
-                if (ret->mHashes[i].isNonZero ())
-                    ret->mIsBranch |= (1 << i);
-            }
+                s.get256 (hashes[i].as_uint256(), i * 32);
+            ret->setHashes (hashes);
             ret->set_common(id.getDepth(), id.getNodeID());
             if (hashValid)
                 ret->mHash = hash;
@@ -177,6 +207,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
         else if (type == 6)
         {
             auto ret = std::make_shared<SHAMapInnerNodeV2>(seq);
+            std::array<SHAMapHash, 16> hashes;
             for (int i = 0; i < (len / 33); ++i)
             {
                 int pos;
@@ -184,10 +215,9 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
                     Throw<std::runtime_error> ("short CI node");
                 if ((pos < 0) || (pos >= 16))
                     Throw<std::runtime_error> ("invalid CI node");
-                s.get256 (ret->mHashes[pos].as_uint256(), i * 33);
-                if (ret->mHashes[pos].isNonZero ())
-                    ret->mIsBranch |= (1 << pos);
+                s.get256 (hashes[pos].as_uint256(), i * 33);
             }
+            ret->setHashes (hashes);
             ret->set_common(id.getDepth(), id.getNodeID());
             if (hashValid)
                 ret->mHash = hash;
@@ -248,12 +278,10 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
                 ret = std::make_shared<SHAMapInnerNodeV2>(seq);
             else
                 ret = std::make_shared<SHAMapInnerNode>(seq);
+            std::array<SHAMapHash, 16> hashes;
             for (int i = 0; i < 16; ++i)
-            {
-                s.get256 (ret->mHashes[i].as_uint256(), i * 32);
-                if (ret->mHashes[i].isNonZero ())
-                    ret->mIsBranch |= (1 << i);
-            }
+                s.get256 (hashes[i].as_uint256(), i * 32);
+            ret->setHashes (hashes);
             if (isV2)
             {
                 auto temp = std::static_pointer_cast<SHAMapInnerNodeV2>(ret);
@@ -306,8 +334,8 @@ SHAMapInnerNode::updateHash()
         sha512_half_hasher h;
         using beast::hash_append;
         hash_append(h, HashPrefix::innerNode);
-        for(auto const& hh : mHashes)
-            hash_append(h, hh);
+        for (int i = 0; i < 16; ++i)
+            hash_append(h, getChildHash (i));
         nh = static_cast<typename
             sha512_half_hasher::result_type>(h);
     }
@@ -319,12 +347,52 @@ SHAMapInnerNode::updateHash()
 void
 SHAMapInnerNode::updateHashDeep()
 {
-    for (auto pos = 0; pos < 16; ++pos)
+    updateChildHashes();
+    updateHash();
+}
+void
+SHAMapInnerNode::updateChildHashes()
+{
+    auto const count = getBranchCount ();
+    for (auto i = 0; i < count; ++i)
     {
-        if (mChildren[pos] != nullptr)
-            mHashes[pos] = mChildren[pos]->getNodeHash();
+        if (mChildren[i] != nullptr)
+            mHashes[i] = mChildren[i]->getNodeHash();
     }
-    updateHash();
+}
+void
+SHAMapAbstractNode::updateHashes (
+    std::vector<std::shared_ptr<SHAMapAbstractNode>> const& nodes,
+    std::vector<Serializer>& raw)
+{
+    raw.resize (nodes.size ());
+    std::vector<std::size_t> pending;
+    std::vector<Slice> messages;
+    pending.reserve (nodes.size ());
+    messages.reserve (nodes.size ());
+    for (std::size_t i = 0; i < nodes.size (); ++i)
+    {
+        auto& node = *nodes[i];
+        if (node.isInner ())
+        {
+            auto& inner = static_cast<SHAMapInnerNode&> (node);
+            inner.updateChildHashes ();
+            if (inner.isEmpty ())
+            {
+                inner.mHash.zero ();
+                raw[i].erase ();
+                continue;
+            }
+        }
+        raw[i].erase ();
+        node.addRaw (raw[i], snfPREFIX);
+        pending.push_back (i);
+        messages.push_back (raw[i].slice ());
+    }
+    std::vector<uint256> digests (messages.size ());
+    sha512HalfBatch (messages.data (), digests.data (), messages.size ());
+    for (std::size_t i = 0; i < pending.size (); ++i)
+        nodes[pending[i]]->mHash = SHAMapHash{digests[i]};
 }
 bool
 SHAMapTreeNode::updateHash()
@@ -370,25 +438,25 @@ SHAMapInnerNode::addRaw(Serializer& s, SHANodeFormat format) const
         if (format == snfPREFIX)
         {
             s.add32 (HashPrefix::innerNode);
-            for (auto const& hh : mHashes)
-                s.add256 (hh.as_uint256());
+            for (int i = 0; i < 16; ++i)
+                s.add256 (getChildHash (i).as_uint256());
         }
         else  
         {
             if (getBranchCount () < 12)
             {
-                for (int i = 0; i < mHashes.size(); ++i)
+                for (int i = 0; i < 16; ++i)
                     if (!isEmptyBranch (i))
                     {
-                        s.add256 (mHashes[i].as_uint256());
+                        s.add256 (mHashes[branchIndex (i)].as_uint256());
                         s.add8 (i);
                     }
                 s.add8 (3);
             }
             else
             {
-                for (auto const& hh : mHashes)
-                    s.add256 (hh.as_uint256());
+                for (int i = 0; i < 16; ++i)
+                    s.add256 (getChildHash (i).as_uint256());
                 s.add8 (2);
             }
         }
@@ -404,7 +472,7 @@ SHAMapInnerNodeV2::addRaw(Serializer& s, SHANodeFormat format) const
         assert(depth_ <= 64);
         s.add32 (HashPrefix::innerNodeV2);
         for (int i = 0 ; i < 16; ++i)
-            s.add256 (mHashes[i].as_uint256());
+            s.add256 (getChildHash (i).as_uint256());
         s.add8(depth_);
         auto x = common_.begin();
         for (auto i = 0; i < (depth_+1)/2; ++i, ++x)
@@ -506,11 +574,7 @@ bool SHAMapInnerNode::isEmpty () const
 int SHAMapInnerNode::getBranchCount () const
 {
     assert (isInner ());
-    int count = 0;
-    for (int i = 0; i < 16; ++i)
-        if (!isEmptyBranch (i))
-            ++count;
-    return count;
+    return std::bitset<16> (mIsBranch).count ();
 }
 std::string
 SHAMapAbstractNode::getString(const SHAMapNodeID & id) const
@@ -526,14 +590,14 @@ std::string
 SHAMapInnerNode::getString(const SHAMapNodeID & id) const
 {
     std::string ret = SHAMapAbstractNode::getString(id);
-    for (int i = 0; i < mHashes.size(); ++i)
+    for (int i = 0; i < 16; ++i)
     {
         if (!isEmptyBranch (i))
         {
             ret += "\nb";
             ret += beast::lexicalCastThrow <std::string> (i);
             ret += " = ";
-            ret += to_string (mHashes[i]);
+            ret += to_string (mHashes[branchIndex (i)]);
         }
     }
     return ret;
@@ -565,13 +629,63 @@ SHAMapInnerNode::setChild(int m, std::shared_ptr<SHAMapAbstractNode> const& chil
     assert (mType == tnINNER);
     assert (mSeq != 0);
     assert (child.get() != this);
-    mHashes[m].zero();
     mHash.zero();
     if (child)
-        mIsBranch |= (1 << m);
-    else
-        mIsBranch &= ~ (1 << m);
-    mChildren[m] = child;
+    {
+        if (isEmptyBranch (m))
+            setBranches (mIsBranch | (1 << m));
+        auto const i = branchIndex (m);
+        mHashes[i].zero();
+        mChildren[i] = child;
+    }
+    else if (!isEmptyBranch (m))
+    {
+        setBranches (mIsBranch & ~ (1 << m));
+    }
+}
+void
+SHAMapInnerNode::setBranches (std::uint16_t isBranch)
+{
+    auto const count = std::bitset<16> (isBranch).count ();
+    std::unique_ptr<SHAMapHash[]> hashes;
+    std::unique_ptr<std::shared_ptr<SHAMapAbstractNode>[]> children;
+    if (count != 0)
+    {
+        hashes = std::make_unique<SHAMapHash[]> (count);
+        children = std::make_unique<std::shared_ptr<SHAMapAbstractNode>[]> (count);
+    }
+    int from = 0;
+    int to = 0;
+    for (int m = 0; m < 16; ++m)
+    {
+        bool const had = (mIsBranch & (1 << m)) != 0;
+        bool const has = (isBranch & (1 << m)) != 0;
+        if (had && has)
+        {
+            hashes[to] = mHashes[from];
+            children[to] = std::move (mChildren[from]);
+        }
+        if (had)
+            ++from;
+        if (has)
+            ++to;
+    }
+    mHashes = std::move (hashes);
+    mChildren = std::move (children);
+    mIsBranch = isBranch;
+}
+void
+SHAMapInnerNode::setHashes (std::array<SHAMapHash, 16> const& hashes)
+{
+    std::uint16_t isBranch = 0;
+    for (int m = 0; m < 16; ++m)
+        if (hashes[m].isNonZero ())
+            isBranch |= (1 << m);
+    setBranches (isBranch);
+    int i = 0;
+    for (auto const& hh : hashes)
+        if (hh.isNonZero ())
+            mHashes[i++] = hh;
 }
 void SHAMapInnerNode::shareChild (int m, std::shared_ptr<SHAMapAbstractNode> const& child)
 {
@@ -580,23 +694,28 @@ void SHAMapInnerNode::shareChild (int m, std::shared_ptr<SHAMapAbstractNode> con
     assert (mSeq != 0);
     assert (child);
     assert (child.get() != this);
-    mChildren[m] = child;
+    assert (!isEmptyBranch (m));
+    mChildren[branchIndex (m)] = child;
 }
 SHAMapAbstractNode*
 SHAMapInnerNode::getChildPointer (int branch)
 {
     assert (branch >= 0 && branch < 16);
     assert (isInner());
-    std::lock_guard <std::mutex> lock (childLock);
-    return mChildren[branch].get ();
+    if (isEmptyBranch (branch))
+        return nullptr;
+    ChildLock lock (*this, 1 << branch);
+    return mChildren[branchIndex (branch)].get ();
 }
 std::shared_ptr<SHAMapAbstractNode>
 SHAMapInnerNode::getChild (int branch)
 {
     assert (branch >= 0 && branch < 16);
     assert (isInner());
-    std::lock_guard <std::mutex> lock (childLock);
-    return mChildren[branch];
+    if (isEmptyBranch (branch))
+        return {};
+    ChildLock lock (*this, 1 << branch);
+    return mChildren[branchIndex (branch)];
 }
 std::shared_ptr<SHAMapAbstractNode>
 SHAMapInnerNode::canonicalizeChild(int branch, std::shared_ptr<SHAMapAbstractNode> node)
@@ -604,16 +723,17 @@ SHAMapInnerNode::canonicalizeChild(int branch, std::shared_ptr<SHAMapAbstractNod
     assert (branch >= 0 && branch < 16);
     assert (isInner());
     assert (node);
-    assert (node->getNodeHash() == mHashes[branch]);
-    std::lock_guard <std::mutex> lock (childLock);
-    if (mChildren[branch])
+    assert (node->getNodeHash() == getChildHash (branch));
+    auto& child = mChildren[branchIndex (branch)];
+    ChildLock lock (*this, 1 << branch);
+    if (child)
     {
-        node = mChildren[branch];
+        node = child;
     }
     else
     {
         assert(std::dynamic_pointer_cast<SHAMapInnerNodeV2>(node) == nullptr);
-        mChildren[branch] = node;
+        child = node;
     }
     return node;
 }
@@ -623,17 +743,18 @@ SHAMapInnerNodeV2::canonicalizeChild(int branch, std::shared_ptr<SHAMapAbstractN
     assert (branch >= 0 && branch < 16);
     assert (isInner());
     assert (node);
-    assert (node->getNodeHash() == mHashes[branch]);
-    std::lock_guard <std::mutex> lock (childLock);
-    if (mChildren[branch])
+    assert (node->getNodeHash() == getChildHash (branch));
+    auto& child = mChildren[branchIndex (branch)];
+    ChildLock lock (*this, 1 << branch);
+    if (child)
     {
-        node = mChildren[branch];
+        node = child;
     }
     else
     {
         assert(std::dynamic_pointer_cast<SHAMapInnerNodeV2>(node) != nullptr ||
                std::dynamic_pointer_cast<SHAMapTreeNode>(node)    != nullptr);
-        mChildren[branch] = node;
+        child = node;
     }
     return node;
 }
@@ -702,10 +823,9 @@ SHAMapInnerNodeV2::setChildren(std::shared_ptr<SHAMapTreeNode> const& child1,
         b2 = *k2 >> 4;
         depth_ = 2*depth_;
     }
-    mChildren[b1] = child1;
-    mIsBranch |= 1 << b1;
-    mChildren[b2] = child2;
-    mIsBranch |= 1 << b2;
+    setBranches (mIsBranch | (1 << b1) | (1 << b2));
+    mChildren[branchIndex (b1)] = child1;
+    mChildren[branchIndex (b2)] = child2;
 }
 void
 SHAMapInnerNodeV2::set_common(int depth, uint256 const& common)
@@ -736,19 +856,12 @@ SHAMapInnerNode::invariants(bool is_v2, bool is_root) const
     assert(!is_v2);
     assert(mType == tnINNER);
     unsigned count = 0;
-    for (int i = 0; i < 16; ++i)
+    for (int i = 0; i < getBranchCount(); ++i)
     {
-        if (mHashes[i].isNonZero())
-        {
-            assert((mIsBranch & (1 << i)) != 0);
-            if (mChildren[i] != nullptr)
-                mChildren[i]->invariants(is_v2);
-            ++count;
-        }
-        else
-        {
-            assert((mIsBranch & (1 << i)) == 0);
-        }
+        assert(mHashes[i].isNonZero());
+        if (mChildren[i] != nullptr)
+            mChildren[i]->invariants(is_v2);
+        ++count;
     }
     if (!is_root)
     {
@@ -765,26 +878,23 @@ SHAMapInnerNodeV2::invariants(bool is_v2, bool is_root) const
     unsigned count = 0;
     for (int i = 0; i < 16; ++i)
     {
-        if (mHashes[i].isNonZero())
+        if (!isEmptyBranch(i))
         {
-            assert((mIsBranch & (1 << i)) != 0);
-            if (mChildren[i] != nullptr)
+            auto const j = branchIndex(i);
+            assert(mHashes[j].isNonZero());
+            if (mChildren[j] != nullptr)
             {
-                assert(mHashes[i] == mChildren[i]->getNodeHash());
+                assert(mHashes[j] == mChildren[j]->getNodeHash());
 #ifndef NDEBUG
-                auto const& childID = mChildren[i]->key();
+                auto const& childID = mChildren[j]->key();
                 SHAMapNodeID nodeID {depth(), common()};
                 assert (i == nodeID.selectBranch(childID));
 #endif
                 assert(has_common_prefix(childID));
-                mChildren[i]->invariants(is_v2);
+                mChildren[j]->invariants(is_v2);
             }
             ++count;
         }
-        else
-        {
-            assert((mIsBranch & (1 << i)) == 0);
-        }
     }
     if (!is_root)
     {
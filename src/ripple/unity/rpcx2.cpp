@@ -6,6 +6,7 @@
 #include <ripple/rpc/handlers/PathFind.cpp>
 #include <ripple/rpc/handlers/PayChanClaim.cpp>
 #include <ripple/rpc/handlers/Peers.cpp>
+#include <ripple/rpc/handlers/PerfHistograms.cpp>
 #include <ripple/rpc/handlers/Ping.cpp>
 #include <ripple/rpc/handlers/Print.cpp>
 #include <ripple/rpc/handlers/Random.cpp>
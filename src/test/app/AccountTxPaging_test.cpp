@@ -192,11 +192,48 @@ class AccountTxPaging_test : public beast::unit_test::suite
             BEAST_EXPECT(! jrr[jss::marker]);
         }
     }
+    void
+    testMarkerBetweenTransactions ()
+    {
+        testcase("Marker between transactions");
+        using namespace test::jtx;
+        Env env(*this);
+        Account A1 {"A1"};
+        Account A2 {"A2"};
+        Account A3 {"A3"};
+        env.fund(XRP(10000), A1, A2, A3);
+        env.close();
+        int const first = env.current()->info().seq;
+        for (auto i = 0; i < 3; ++i)
+        {
+            env(pay(A1, A2, XRP(1)));
+            env(pay(A2, A3, XRP(1)));
+            env(pay(A3, A1, XRP(1)));
+            env(pay(A2, A3, XRP(1)));
+            env.close();
+        }
+        auto const all = next(env, A1, first, first + 2, 100, true)[jss::transactions];
+        if (! BEAST_EXPECT(all.isArray() && all.size() == 6))
+            return;
+        Json::Value marker;
+        marker[jss::ledger] = all[0u][jss::tx][jss::ledger_index];
+        marker[jss::seq] = all[0u][jss::meta]
+            [sfTransactionIndex.jsonName].asUInt() + 1;
+        auto const jrr = next(env, A1, first, first + 2, 100, true, marker);
+        auto const& txs = jrr[jss::transactions];
+        if (! BEAST_EXPECT(txs.isArray() && txs.size() == all.size() - 1))
+            return;
+        for (Json::UInt i = 0; i < txs.size(); ++i)
+            BEAST_EXPECT(txs[i][jss::tx][jss::hash] ==
+                all[i + 1][jss::tx][jss::hash]);
+        BEAST_EXPECT(! jrr[jss::marker]);
+    }
 public:
     void
     run() override
     {
         testAccountTxPaging();
+        testMarkerBetweenTransactions();
     }
 };
 BEAST_DEFINE_TESTSUITE(AccountTxPaging,app,ripple);
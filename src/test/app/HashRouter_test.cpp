@@ -2,6 +2,12 @@
 #include <ripple/app/misc/HashRouter.h>
 #include <ripple/basics/chrono.h>
 #include <ripple/beast/unit_test.h>
+#include <ripple/beast/xor_shift_engine.h>
+#include <ripple/protocol/digest.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
 namespace ripple {
 namespace test {
 class HashRouter_test : public beast::unit_test::suite
@@ -165,6 +171,52 @@ class HashRouter_test : public beast::unit_test::suite
         ++stopwatch;
         BEAST_EXPECT(router.shouldProcess(key, peer, flags, 1s));
     }
+    void
+    testShards()
+    {
+        using namespace std::chrono_literals;
+        auto const keyInShard = [](std::uint32_t shard, std::uint64_t n)
+        {
+            uint256 key(n);
+            std::memcpy (key.data(), &shard, sizeof (shard));
+            return key;
+        };
+        TestStopwatch stopwatch;
+        HashRouter router(stopwatch, 2s, 2);
+        uint256 const a1 = keyInShard(1, 1);
+        uint256 const a2 = keyInShard(1, 2);
+        uint256 const b1 = keyInShard(HashRouter::shardCount - 1, 1);
+        uint256 const b2 = keyInShard(HashRouter::shardCount - 1, 2);
+        BEAST_EXPECT(router.setFlags(a1, 10));
+        BEAST_EXPECT(router.setFlags(b1, 20));
+        BEAST_EXPECT(!router.setFlags(a1, 10));
+        BEAST_EXPECT(router.setFlags(b1, 10));
+        BEAST_EXPECT(router.getFlags(a1) == 10);
+        BEAST_EXPECT(router.getFlags(b1) == 30);
+        router.addSuppressionPeer(a1, 1);
+        router.addSuppressionPeer(b1, 2);
+        router.addSuppressionPeer(b1, 3);
+        auto peers = router.shouldRelay(a1);
+        BEAST_EXPECT(peers && peers->size() == 1);
+        BEAST_EXPECT(!router.shouldRelay(a1));
+        peers = router.shouldRelay(b1);
+        BEAST_EXPECT(peers && peers->size() == 2);
+        BEAST_EXPECT(!router.shouldRelay(b1));
+        ++stopwatch;
+        ++stopwatch;
+        ++stopwatch;
+        router.setFlags(a2, 40);
+        BEAST_EXPECT(router.getFlags(b1) == 30);
+        BEAST_EXPECT(router.getFlags(a1) == 0);
+        BEAST_EXPECT(router.getFlags(a2) == 40);
+        ++stopwatch;
+        ++stopwatch;
+        ++stopwatch;
+        router.setFlags(b2, 50);
+        BEAST_EXPECT(router.getFlags(b1) == 0);
+        BEAST_EXPECT(router.getFlags(b2) == 50);
+        BEAST_EXPECT(router.getFlags(a2) == 40);
+    }
 public:
     void
     run() override
@@ -176,8 +228,70 @@ public:
         testRelay();
         testRecover();
         testProcess();
+        testShards();
+    }
+};
+class HashRouter_manual_test : public beast::unit_test::suite
+{
+public:
+    void
+    run() override
+    {
+        using namespace std::chrono;
+        std::size_t const keyCount = 1 << 16;
+        std::size_t const opsPerThread = 1 << 20;
+        std::vector<uint256> keys;
+        keys.reserve (keyCount);
+        for (std::size_t i = 0; i < keyCount; ++i)
+            keys.push_back (sha512Half (i));
+        for (int threads = 1; threads <= 64; threads *= 2)
+        {
+            testcase ("threads: " + std::to_string (threads));
+            HashRouter router (stopwatch(), HashRouter::getDefaultHoldTime (),
+                HashRouter::getDefaultRecoverLimit ());
+            std::atomic<std::size_t> fresh {0};
+            auto const start = steady_clock::now();
+            std::vector<std::thread> peers;
+            for (int t = 0; t < threads; ++t)
+            {
+                peers.emplace_back ([&, t]
+                {
+                    beast::xor_shift_engine rng (t + 1);
+                    std::size_t n = 0;
+                    for (std::size_t i = 0; i < opsPerThread / threads; ++i)
+                    {
+                        auto const& key = keys[rng() % keyCount];
+                        int flags;
+                        switch (i % 4)
+                        {
+                        case 0:
+                            n += router.shouldProcess (key, t, flags, 10s);
+                            break;
+                        case 1:
+                            n += router.addSuppressionPeer (key, t);
+                            break;
+                        case 2:
+                            n += router.shouldRelay (key) ? 1 : 0;
+                            break;
+                        default:
+                            n += router.setFlags (key, SF_BAD);
+                            break;
+                        }
+                    }
+                    fresh += n;
+                });
+            }
+            for (auto& t : peers)
+                t.join();
+            auto const elapsed =
+                duration_cast<duration<double>> (steady_clock::now() - start);
+            BEAST_EXPECT (fresh > 0);
+            log << "    " << static_cast<std::uint64_t> (
+                opsPerThread / elapsed.count()) << " ops/sec" << std::endl;
+        }
     }
 };
 BEAST_DEFINE_TESTSUITE(HashRouter, app, ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(HashRouter_manual, app, ripple);
 }
 }
@@ -2,6 +2,8 @@
 #include <test/jtx.h>
 #include <ripple/beast/unit_test.h>
 #include <algorithm>
+#include <chrono>
+#include <vector>
 namespace ripple {
 namespace test {
 class PlumpBook_test : public beast::unit_test::suite
@@ -147,5 +149,57 @@ public:
     }
 };
 BEAST_DEFINE_TESTSUITE_MANUAL_PRIO(FindOversizeCross,tx,ripple,50);
+class STTx_json_manual_test : public beast::unit_test::suite
+{
+public:
+    void run() override
+    {
+        using namespace std::chrono;
+        using namespace jtx;
+        Env env (*this);
+        auto const gw = Account ("gw");
+        auto const alice = Account ("alice");
+        auto const bob = Account ("bob");
+        auto const USD = gw["USD"];
+        env.fund (XRP(10000), gw, alice, bob);
+        env.close();
+        env (trust (alice, USD(1000)));
+        env (trust (bob, USD(1000)));
+        env.close();
+        env (pay (gw, alice, USD(500)));
+        env (pay (alice, bob, XRP(100)));
+        env (offer (alice, XRP(50), USD(10)));
+        env (offer (bob, USD(10), XRP(50)));
+        env.close();
+        std::vector<std::shared_ptr<STTx const>> txs;
+        std::vector<std::shared_ptr<STObject const>> metas;
+        for (auto const& item : env.closed()->txs)
+        {
+            txs.push_back (item.first);
+            metas.push_back (item.second);
+        }
+        BEAST_EXPECT (! txs.empty());
+        std::size_t const iterations = 100000;
+        auto measure = [&](std::string const& name, auto const& objects)
+        {
+            testcase (name);
+            std::size_t members = 0;
+            auto const start = steady_clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+            {
+                auto const& obj = objects[i % objects.size()];
+                members += obj->getJson (JsonOptions::none).size();
+            }
+            auto const elapsed =
+                duration_cast<duration<double>> (steady_clock::now() - start);
+            BEAST_EXPECT (members > 0);
+            log << "    " << static_cast<std::uint64_t> (
+                iterations / elapsed.count()) << " getJson/sec" << std::endl;
+        };
+        measure ("STTx", txs);
+        measure ("metadata", metas);
+    }
+};
+BEAST_DEFINE_TESTSUITE_MANUAL(STTx_json_manual,tx,ripple);
 } 
 } 
@@ -1,5 +1,7 @@
 
+#include <ripple/app/ledger/OrderBookDB.h>
 #include <ripple/app/paths/AccountCurrencies.h>
+#include <ripple/app/paths/RippleLineCache.h>
 #include <ripple/basics/contract.h>
 #include <ripple/core/JobQueue.h>
 #include <ripple/json/json_reader.h>
@@ -17,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 namespace ripple {
 namespace test {
 namespace detail {
@@ -1158,6 +1161,87 @@ public:
             stpath(IPE(G2["HKD"]), G2)));
     }
     void
+    line_cache_advance()
+    {
+        testcase("line cache advance");
+        using namespace jtx;
+        Env env(*this);
+        auto const gw = Account("gw");
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+        auto const USD = gw["USD"];
+        env.fund(XRP(10000), gw, alice, bob);
+        env.trust(USD(1000), alice, bob);
+        env(pay(gw, alice, USD(100)));
+        env(pay(gw, bob, USD(100)));
+        env.close();
+        RippleLineCache first (env.closed());
+        auto const aliceLines = first.getRippleLines(alice.id());
+        auto const bobLines = first.getRippleLines(bob.id());
+        if (! BEAST_EXPECT(aliceLines.size() == 1 && bobLines.size() == 1))
+            return;
+        env(pay(gw, alice, USD(50)));
+        env.close();
+        BEAST_EXPECT(first.isParentOf(*env.closed()));
+        RippleLineCache second (env.closed(), first, env.journal);
+        BEAST_EXPECT(! second.isParentOf(*env.closed()));
+        auto const& newAlice = second.getRippleLines(alice.id());
+        auto const& newBob = second.getRippleLines(bob.id());
+        if (! BEAST_EXPECT(newAlice.size() == 1 && newBob.size() == 1))
+            return;
+        BEAST_EXPECT(newAlice[0] != aliceLines[0]);
+        BEAST_EXPECT(newAlice[0]->getBalance().getText() == "150");
+        BEAST_EXPECT(newBob[0] == bobLines[0]);
+    }
+    void
+    order_book_removal()
+    {
+        testcase("order book removal");
+        using namespace jtx;
+        Env env(*this);
+        auto const gw = Account("gw");
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+        auto const USD = gw["USD"];
+        env.fund(XRP(10000), gw, alice, bob);
+        env.trust(USD(1000), alice, bob);
+        env(pay(gw, alice, USD(100)));
+        env.close();
+        auto& books = env.app().getOrderBookDB();
+        auto advance = [&env]()
+        {
+            env.close();
+            env.app().getJobQueue().rendezvous();
+        };
+        advance();
+        BEAST_EXPECT(! books.isBookToXRP(USD));
+        BEAST_EXPECT(books.getBooksByTakerPays(USD).empty());
+        auto const first = env.seq(alice);
+        env(offer(alice, USD(10), XRP(10)));
+        auto const second = env.seq(alice);
+        env(offer(alice, USD(10), XRP(20)));
+        advance();
+        BEAST_EXPECT(books.isBookToXRP(USD));
+        BEAST_EXPECT(books.getBooksByTakerPays(USD).size() == 1);
+        env(offer_cancel(alice, first));
+        advance();
+        BEAST_EXPECT(books.isBookToXRP(USD));
+        BEAST_EXPECT(books.getBooksByTakerPays(USD).size() == 1);
+        env(offer_cancel(alice, second));
+        advance();
+        BEAST_EXPECT(! books.isBookToXRP(USD));
+        BEAST_EXPECT(books.getBooksByTakerPays(USD).empty());
+        env(offer(alice, XRP(10), USD(10)));
+        advance();
+        BEAST_EXPECT(books.getBooksByTakerPays(xrpIssue()).size() == 1);
+        BEAST_EXPECT(! books.isBookToXRP(xrpIssue()));
+        env(offer(bob, USD(10), XRP(10)));
+        advance();
+        env.require(owners(alice, 1), owners(bob, 1));
+        BEAST_EXPECT(books.getBooksByTakerPays(xrpIssue()).empty());
+        BEAST_EXPECT(books.getBooksByTakerPays(USD).empty());
+    }
+    void
     run() override
     {
         source_currencies_limit();
@@ -1185,8 +1269,75 @@ public:
         path_find_04();
         path_find_05();
         path_find_06();
+        line_cache_advance();
+        order_book_removal();
+    }
+};
+class Path_manual_test : public Path_test
+{
+public:
+    void
+    run() override
+    {
+        using namespace jtx;
+        using namespace std::chrono;
+        Env env(*this);
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+        std::vector<Account> gateways;
+        for (int i = 0; i < 4; ++i)
+            gateways.emplace_back("G" + std::to_string(i));
+        std::vector<Account> makers;
+        for (int i = 0; i < 6; ++i)
+            makers.emplace_back("M" + std::to_string(i));
+        env.fund(XRP(100000), alice, bob);
+        for (auto const& a : gateways)
+            env.fund(XRP(100000), a);
+        for (auto const& a : makers)
+            env.fund(XRP(100000), a);
+        env.close();
+        for (auto const& gw : gateways)
+        {
+            env.trust(gw["USD"](10000), alice, bob);
+            for (auto const& m : makers)
+                env.trust(gw["USD"](10000), m);
+        }
+        env.close();
+        for (auto const& gw : gateways)
+        {
+            env(pay(gw, alice, gw["USD"](1000)));
+            for (auto const& m : makers)
+                env(pay(gw, m, gw["USD"](1000)));
+        }
+        env.close();
+        for (auto const& m : makers)
+        {
+            for (auto const& in : gateways)
+            {
+                env(offer(m, XRP(100), in["USD"](100)));
+                for (auto const& out : gateways)
+                {
+                    if (in.id() != out.id())
+                        env(offer(m, in["USD"](100), out["USD"](99)));
+                }
+            }
+        }
+        env.close();
+        std::size_t const iterations = 20;
+        auto const start = steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            auto const result = find_paths_request(
+                env, alice, bob, bob["USD"](50));
+            BEAST_EXPECT(result.isMember(jss::alternatives));
+        }
+        auto const elapsed =
+            duration_cast<duration<double>> (steady_clock::now() - start);
+        log << "    " << iterations / elapsed.count() <<
+            " ripple_path_find/sec" << std::endl;
     }
 };
 BEAST_DEFINE_TESTSUITE(Path,app,ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(Path_manual,app,ripple);
 } 
 } 
@@ -1,17 +1,69 @@
 
+#include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/SHAMapStore.h>
 #include <ripple/core/ConfigSections.h>
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/core/SociDB.h>
+#include <ripple/nodestore/DatabaseRotating.h>
 #include <ripple/protocol/jss.h>
 #include <test/jtx.h>
 #include <test/jtx/envconfig.h>
+#include <atomic>
+#include <functional>
 namespace ripple {
 namespace test {
 class SHAMapStore_test : public beast::unit_test::suite
 {
     static auto const deleteInterval = 8;
+    class RotationLogs : public Logs
+    {
+        class CopySink : public beast::Journal::Sink
+        {
+            RotationLogs& logs_;
+        public:
+            CopySink(beast::severities::Severity threshold,
+                RotationLogs& logs)
+                : beast::Journal::Sink(threshold, false)
+                , logs_(logs)
+            {
+            }
+            void
+            write(beast::severities::Severity level,
+                std::string const& text) override
+            {
+                if (text.find("copied ledger") != std::string::npos &&
+                    logs_.armed_.exchange(false))
+                {
+                    logs_.afterCopy_();
+                }
+            }
+        };
+        beast::unit_test::suite& suite_;
+        std::function<void()> afterCopy_;
+        std::atomic<bool> armed_ {false};
+    public:
+        explicit RotationLogs(beast::unit_test::suite& suite)
+            : Logs(beast::severities::kError)
+            , suite_(suite)
+        {
+        }
+        std::unique_ptr<beast::Journal::Sink>
+        makeSink(std::string const& partition,
+            beast::severities::Severity threshold) override
+        {
+            if (partition == "SHAMapStore")
+                return std::make_unique<CopySink>(threshold, *this);
+            return std::make_unique<SuiteJournalSink>(
+                partition, threshold, suite_);
+        }
+        void
+        afterNextCopy(std::function<void()> f)
+        {
+            afterCopy_ = std::move(f);
+            armed_ = true;
+        }
+    };
     static
     auto
     onlineDelete(std::unique_ptr<Config> cfg)
@@ -323,6 +375,13 @@ public:
         ledgerCheck(env, ledgerSeq - lastRotated, lastRotated);
         BEAST_EXPECT(lastRotated != store.getLastRotated());
         lastRotated = store.getLastRotated();
+        {
+            auto const progress = store.copyProgress();
+            BEAST_EXPECT(progress[jss::status] == "complete");
+            BEAST_EXPECT(progress[jss::ledger_index] == lastRotated);
+            BEAST_EXPECT(progress[jss::type] == "full");
+            BEAST_EXPECT(progress[jss::nodes].asString() != "0");
+        }
         for (; ledgerSeq < lastRotated + deleteInterval + 1; ++ledgerSeq)
         {
             env.close();
@@ -334,6 +393,82 @@ public:
         ledgerCheck(env, deleteInterval + 1, lastRotated);
         BEAST_EXPECT(lastRotated != store.getLastRotated());
     }
+    void testIncremental()
+    {
+        testcase("incremental copy after an interrupted rotation");
+        using namespace jtx;
+        using namespace std::chrono_literals;
+        auto logs = std::make_unique<RotationLogs>(*this);
+        auto& rotation = *logs;
+        Env env(*this, envconfig(onlineDelete), std::move(logs));
+        env.app().logs()["SHAMapStore"].threshold(beast::severities::kDebug);
+        auto& store = env.app().getSHAMapStore();
+        auto& dbr = dynamic_cast<NodeStore::DatabaseRotating&>(
+            env.app().getNodeStore());
+        auto ledgerSeq = waitForReady(env);
+        auto lastRotated = ledgerSeq - 1;
+        Account const alice {"alice"};
+        env.fund(XRP(10000), noripple(alice));
+        for (; ledgerSeq < lastRotated + deleteInterval; ++ledgerSeq)
+        {
+            for (int i = 0; i < 10; ++i)
+            {
+                env.fund(XRP(1000), noripple(
+                    "acct" + to_string(ledgerSeq) + "_" + to_string(i)));
+            }
+            env.close();
+        }
+        store.rendezvous();
+        BEAST_EXPECT(store.getLastRotated() == lastRotated);
+        rotation.afterNextCopy([&env]()
+            {
+                env.timeKeeper().set(env.timeKeeper().now() + 1h);
+            });
+        env.close();
+        ++ledgerSeq;
+        store.rendezvous();
+        BEAST_EXPECT(store.getLastRotated() == lastRotated);
+        std::uint64_t fullNodes = 0;
+        {
+            auto const progress = store.copyProgress();
+            BEAST_EXPECT(progress[jss::status] == "complete");
+            BEAST_EXPECT(progress[jss::ledger_index] == ledgerSeq - 1);
+            BEAST_EXPECT(progress[jss::type] == "full");
+            fullNodes = std::stoull(progress[jss::nodes].asString());
+            BEAST_EXPECT(fullNodes != 0);
+        }
+        auto const backend = dbr.getWritableBackend().get();
+        env(pay(env.master, alice, XRP(1)));
+        env.close();
+        ++ledgerSeq;
+        store.rendezvous();
+        BEAST_EXPECT(store.getLastRotated() == ledgerSeq - 1);
+        {
+            auto const progress = store.copyProgress();
+            BEAST_EXPECT(progress[jss::status] == "complete");
+            BEAST_EXPECT(progress[jss::ledger_index] == ledgerSeq - 1);
+            BEAST_EXPECT(progress[jss::type] == "incremental");
+            auto const nodes = std::stoull(progress[jss::nodes].asString());
+            BEAST_EXPECT(nodes != 0 && nodes < fullNodes);
+        }
+        BEAST_EXPECT(dbr.getWritableBackend().get() != backend);
+        auto const ledger = env.app().getLedgerMaster().getValidatedLedger();
+        if (!BEAST_EXPECT(ledger && ledger->info().seq == ledgerSeq - 1))
+            return;
+        std::size_t missing = 0;
+        ledger->stateMap().visitNodes(
+            [&](SHAMapAbstractNode& node)
+            {
+                std::shared_ptr<NodeObject> object;
+                if (backend->fetch(node.getNodeHash().as_uint256().data(),
+                    &object) != NodeStore::ok)
+                {
+                    ++missing;
+                }
+                return true;
+            });
+        BEAST_EXPECT(missing == 0);
+    }
     void testCanDelete()
     {
         testcase("online_delete with advisory_delete");
@@ -447,9 +582,52 @@ public:
     {
         testClear();
         testAutomatic();
+        testIncremental();
         testCanDelete();
     }
 };
+class SHAMapStore_manual_test : public beast::unit_test::suite
+{
+    static auto const deleteInterval = 8;
+public:
+    void run() override
+    {
+        using namespace jtx;
+        for (auto const threads : {1, 4, 8})
+        {
+            Env env(*this, envconfig(
+                [threads](std::unique_ptr<Config> cfg)
+                {
+                    cfg->LEDGER_HISTORY = deleteInterval;
+                    auto& section = cfg->section(ConfigSection::nodeDatabase());
+                    section.set("online_delete", to_string(deleteInterval));
+                    section.set("copy_threads", to_string(threads));
+                    return cfg;
+                }));
+            auto& store = env.app().getSHAMapStore();
+            for (int i = 0; i < 20; ++i)
+            {
+                for (int j = 0; j < 250; ++j)
+                {
+                    env.fund(XRP(1000), noripple(
+                        "acct" + to_string(i) + "_" + to_string(j)));
+                }
+                env.close();
+            }
+            for (int i = 0; i <= deleteInterval; ++i)
+                env.close();
+            store.rendezvous();
+            auto const progress = store.copyProgress();
+            BEAST_EXPECT(progress[jss::status] == "complete");
+            log << "    copy_threads " << threads <<
+                ": " << progress[jss::nodes].asString() << " nodes in " <<
+                progress[jss::duration_us].asString() << "us, " <<
+                progress[jss::nodes_per_second].asUInt() << " nodes/sec" <<
+                std::endl;
+        }
+    }
+};
 BEAST_DEFINE_TESTSUITE(SHAMapStore,app,ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(SHAMapStore_manual,app,ripple);
 }
 }
@@ -0,0 +1,171 @@
+
+#include <ripple/app/misc/SignatureVerifier.h>
+#include <ripple/basics/random.h>
+#include <ripple/core/Stoppable.h>
+#include <ripple/protocol/jss.h>
+#include <ripple/protocol/SecretKey.h>
+#include <ripple/protocol/digest.h>
+#include <ripple/beast/unit_test.h>
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+namespace ripple {
+namespace test {
+class SignatureVerifier_test : public beast::unit_test::suite
+{
+    class Results
+    {
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        std::vector<int> results_;
+        std::size_t remaining_;
+    public:
+        explicit
+        Results (std::size_t n)
+            : results_ (n, -1)
+            , remaining_ (n)
+        {
+        }
+        SignatureVerifier::Callback
+        callback (std::size_t i)
+        {
+            return [this, i] (bool valid)
+            {
+                std::lock_guard<std::mutex> lock (mutex_);
+                results_[i] = valid;
+                if (--remaining_ == 0)
+                    cond_.notify_all();
+            };
+        }
+        std::vector<int> const&
+        wait ()
+        {
+            std::unique_lock<std::mutex> lock (mutex_);
+            cond_.wait (lock, [this] { return remaining_ == 0; });
+            return results_;
+        }
+    };
+    void
+    testVerify()
+    {
+        testcase ("verify");
+        RootStoppable parent ("TestRootStoppable");
+        SignatureVerifier verifier (parent, 2);
+        std::size_t const n = 300;
+        Results results (n);
+        std::vector<bool> expected;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            bool const good = i % 7 != 3;
+            expected.push_back (good);
+            auto const data = rand_int<std::uint64_t>();
+            Blob message (reinterpret_cast<std::uint8_t const*>(&data),
+                reinterpret_cast<std::uint8_t const*>(&data) + sizeof(data));
+            if (i % 5 == 0)
+            {
+                auto const keypair = randomKeyPair (KeyType::secp256k1);
+                auto const digest = sha512Half (makeSlice (message));
+                auto sig = signDigest (keypair.first, keypair.second, digest);
+                if (! good)
+                    sig.data()[10]++;
+                BEAST_EXPECT(verifier.verifyDigest (keypair.first, digest,
+                    sig, true, i % 10 == 0, results.callback (i)));
+            }
+            else
+            {
+                auto const keypair = randomKeyPair (i % 5 == 1 ?
+                    KeyType::secp256k1 : KeyType::ed25519);
+                auto sig = sign (keypair.first, keypair.second,
+                    makeSlice (message));
+                if (! good)
+                    message[0]++;
+                BEAST_EXPECT(verifier.verify (keypair.first,
+                    std::move (message), sig, true, results.callback (i)));
+            }
+        }
+        auto const& valid = results.wait();
+        for (std::size_t i = 0; i < n; ++i)
+            BEAST_EXPECT(valid[i] == expected[i]);
+        BEAST_EXPECT(verifier.pending() == 0);
+        Json::Value counts;
+        verifier.getCountsJson (counts);
+        auto const& jv = counts[jss::sig_verify];
+        BEAST_EXPECT(jv[jss::threads].asUInt() == 2);
+        BEAST_EXPECT(jv["consensus"][jss::served] == "30");
+        BEAST_EXPECT(jv["untrusted"][jss::served] == "30");
+        BEAST_EXPECT(jv["secp256k1"][jss::served] == "60");
+        BEAST_EXPECT(jv["ed25519"][jss::served] == "180");
+        BEAST_EXPECT(jv["ed25519"][jss::dropped] == "0");
+    }
+    void
+    testLimits()
+    {
+        testcase ("limits");
+        RootStoppable parent ("TestRootStoppable");
+        SignatureVerifier verifier (parent, 1);
+        std::promise<void> entered;
+        std::promise<void> release;
+        auto const blocked = release.get_future().share();
+        auto const edKeys = randomKeyPair (KeyType::ed25519);
+        BEAST_EXPECT(verifier.verify (edKeys.first, {},
+            sign (edKeys.first, edKeys.second, Slice{}), true,
+            [&entered, blocked] (bool)
+            {
+                entered.set_value();
+                blocked.wait();
+            }));
+        entered.get_future().wait();
+        auto const keypair = randomKeyPair (KeyType::secp256k1);
+        auto const digest = sha512Half (std::uint64_t{42});
+        auto const sig = signDigest (keypair.first, keypair.second, digest);
+        std::size_t const n = SignatureVerifier::untrustedLimit;
+        Results results (n + 1);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            BEAST_EXPECT(verifier.verifyDigest (keypair.first, digest,
+                sig, true, false, results.callback (i)));
+        }
+        BEAST_EXPECT(! verifier.verifyDigest (keypair.first, digest,
+            sig, true, false, [] (bool) {}));
+        BEAST_EXPECT(verifier.verifyDigest (keypair.first, digest,
+            sig, true, true, results.callback (n)));
+        Json::Value counts;
+        verifier.getCountsJson (counts);
+        auto const& jv = counts[jss::sig_verify];
+        BEAST_EXPECT(jv["untrusted"][jss::limit].asUInt() == n);
+        BEAST_EXPECT(jv["untrusted"][jss::dropped] == "1");
+        BEAST_EXPECT(jv["consensus"][jss::limit].asUInt() ==
+            SignatureVerifier::queueLimit);
+        BEAST_EXPECT(jv["consensus"][jss::dropped] == "0");
+        release.set_value();
+        auto const& valid = results.wait();
+        BEAST_EXPECT(std::all_of (valid.begin(), valid.end(),
+            [] (int v) { return v == 1; }));
+    }
+    void
+    testStop()
+    {
+        testcase ("stop");
+        RootStoppable parent ("TestRootStoppable");
+        SignatureVerifier verifier (parent, 1);
+        parent.prepare();
+        parent.start();
+        parent.stop (beast::Journal {beast::Journal::getNullSink()});
+        auto const keypair = randomKeyPair (KeyType::ed25519);
+        auto const sig = sign (keypair.first, keypair.second, Slice{});
+        BEAST_EXPECT(! verifier.verify (keypair.first, {}, sig, true,
+            [] (bool) {}));
+    }
+    void
+    run() override
+    {
+        testVerify();
+        testLimits();
+        testStop();
+    }
+};
+BEAST_DEFINE_TESTSUITE(SignatureVerifier,app,ripple);
+}
+}
@@ -0,0 +1,189 @@
+
+#include <ripple/basics/Archive.h>
+#include <ripple/beast/unit_test.h>
+#include <archive.h>
+#include <archive_entry.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+namespace ripple {
+class Archive_test : public beast::unit_test::suite
+{
+    using path = boost::filesystem::path;
+    using Files = std::vector<std::pair<std::string, std::string>>;
+    static
+    std::vector<std::uint8_t>
+    makeTarLz4(Files const& files)
+    {
+        std::vector<std::uint8_t> buffer(8 << 20);
+        std::size_t used {0};
+        auto aw {archive_write_new()};
+        archive_write_set_format_ustar(aw);
+        archive_write_add_filter_lz4(aw);
+        archive_write_open_memory(aw, buffer.data(), buffer.size(), &used);
+        auto entry {archive_entry_new()};
+        archive_entry_set_pathname(entry, "5");
+        archive_entry_set_filetype(entry, AE_IFDIR);
+        archive_entry_set_perm(entry, 0755);
+        archive_write_header(aw, entry);
+        for (auto const& file : files)
+        {
+            archive_entry_clear(entry);
+            archive_entry_set_pathname(entry, ("5/" + file.first).c_str());
+            archive_entry_set_filetype(entry, AE_IFREG);
+            archive_entry_set_perm(entry, 0644);
+            archive_entry_set_size(entry, file.second.size());
+            archive_write_header(aw, entry);
+            archive_write_data(aw, file.second.data(), file.second.size());
+        }
+        archive_entry_free(entry);
+        archive_write_close(aw);
+        archive_write_free(aw);
+        buffer.resize(used);
+        return buffer;
+    }
+    static
+    Files
+    makeFiles()
+    {
+        std::mt19937 gen;
+        std::string dat(512 * 1024, 0);
+        for (auto& c : dat)
+            c = static_cast<char>(gen());
+        return {{"nudb.dat", dat}, {"nudb.key", "key file"}};
+    }
+    bool
+    check(path const& dir, Files const& files)
+    {
+        for (auto const& file : files)
+        {
+            std::ifstream ifs((dir / "5" / file.first).string(),
+                std::ios::binary);
+            std::string const contents {
+                std::istreambuf_iterator<char>(ifs),
+                std::istreambuf_iterator<char>()};
+            if (contents != file.second)
+                return false;
+        }
+        return true;
+    }
+    static
+    path
+    tempDir()
+    {
+        auto const dir {boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path()};
+        boost::filesystem::create_directories(dir);
+        return dir;
+    }
+    void
+    testFile()
+    {
+        testcase("extract file");
+        auto const files {makeFiles()};
+        auto const data {makeTarLz4(files)};
+        auto const dir {tempDir()};
+        auto const src {dir / "archive.tar.lz4"};
+        {
+            std::ofstream ofs(src.string(), std::ios::binary);
+            ofs.write(reinterpret_cast<char const*>(data.data()), data.size());
+        }
+        extractTarLz4(src, dir);
+        BEAST_EXPECT(check(dir, files));
+        boost::filesystem::remove_all(dir);
+    }
+    void
+    testStream()
+    {
+        testcase("extract stream");
+        auto const files {makeFiles()};
+        auto const data {makeTarLz4(files)};
+        auto const dir {tempDir()};
+        {
+            TarLz4Stream stream(dir, 4);
+            for (std::size_t i = 0; i < data.size(); i += 1000)
+            {
+                stream.write(data.data() + i,
+                    std::min<std::size_t>(1000, data.size() - i));
+            }
+            stream.finish();
+        }
+        BEAST_EXPECT(check(dir, files));
+        boost::filesystem::remove_all(dir);
+    }
+    void
+    testTruncated()
+    {
+        testcase("truncated stream");
+        auto const data {makeTarLz4(makeFiles())};
+        auto const dir {tempDir()};
+        {
+            TarLz4Stream stream(dir);
+            stream.write(data.data(), data.size() / 2);
+            try
+            {
+                stream.finish();
+                fail("truncated archive extracted");
+            }
+            catch (std::exception const&)
+            {
+                pass();
+            }
+        }
+        {
+            TarLz4Stream stream(dir);
+            stream.write(data.data(), data.size() / 2);
+        }
+        pass();
+        boost::filesystem::remove_all(dir);
+    }
+    void
+    testAbort()
+    {
+        testcase("abort stream");
+        auto const data {makeTarLz4(makeFiles())};
+        auto const dir {tempDir()};
+        auto const stream {std::make_shared<TarLz4Stream>(dir, 1)};
+        std::thread writer([stream, &data]
+        {
+            for (std::size_t i = 0; i < data.size(); i += 1000)
+            {
+                stream->write(data.data() + i,
+                    std::min<std::size_t>(1000, data.size() - i));
+            }
+        });
+        stream->abort();
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(dir, ec);
+        BEAST_EXPECT(!ec);
+        BEAST_EXPECT(!boost::filesystem::exists(dir));
+        writer.join();
+        BEAST_EXPECT(!boost::filesystem::exists(dir));
+        stream->abort();
+        try
+        {
+            stream->finish();
+            fail("aborted archive extracted");
+        }
+        catch (std::exception const&)
+        {
+            pass();
+        }
+    }
+public:
+    void
+    run() override
+    {
+        testFile();
+        testStream();
+        testTruncated();
+        testAbort();
+    }
+};
+BEAST_DEFINE_TESTSUITE(Archive,basics,ripple);
+} 
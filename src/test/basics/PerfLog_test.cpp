@@ -1,4 +1,5 @@
 
+#include <ripple/basics/LatencyHistogram.h>
 #include <ripple/basics/PerfLog.h>
 #include <ripple/basics/random.h>
 #include <ripple/beast/unit_test.h>
@@ -765,6 +766,71 @@ public:
             BEAST_EXPECT(file_size (fullPath) > firstFileSize);
         }
     }
+    void testHistograms ()
+    {
+        using namespace std::chrono;
+        {
+            LatencyHistogram h;
+            BEAST_EXPECT(h.count() == 0);
+            BEAST_EXPECT(h.percentile (0.5) == microseconds (0));
+            for (int i = 1; i <= 1000; ++i)
+                h.insert (microseconds (i));
+            BEAST_EXPECT(h.count() == 1000);
+            BEAST_EXPECT(h.max() == microseconds (1000));
+            auto near = [] (microseconds got, std::int64_t want)
+            {
+                return got.count() >= want &&
+                    got.count() <= want + want / LatencyHistogram::subBuckets;
+            };
+            BEAST_EXPECT(near (h.percentile (0.5), 500));
+            BEAST_EXPECT(near (h.percentile (0.99), 990));
+            BEAST_EXPECT(h.percentile (0.999) <= microseconds (1000));
+            BEAST_EXPECT(h.percentile (1.0) == microseconds (1000));
+            LatencyHistogram big;
+            big.insert (hours (24 * 365));
+            h.merge (big);
+            BEAST_EXPECT(h.count() == 1001);
+            BEAST_EXPECT(h.max() == hours (24 * 365));
+            BEAST_EXPECT(near (h.percentile (0.5), 500));
+        }
+        PerfLogParent parent {j_};
+        auto perfLog {getPerfLog (parent, WithFile::no)};
+        parent.doStart();
+        {
+            Json::Value const empty {perfLog->histogramsJson()};
+            BEAST_EXPECT(empty[jss::rpc].size() == 0);
+            BEAST_EXPECT(empty[jss::job_queue].size() == 0);
+        }
+        auto const& jobType = JobTypes::instance().get (jtCLIENT);
+        for (int i = 1; i <= 100; ++i)
+        {
+            perfLog->jobQueue (jtCLIENT);
+            perfLog->jobStart (jtCLIENT, microseconds (i),
+                steady_clock::now(), 0);
+            perfLog->jobFinish (jtCLIENT, microseconds (10 * i), 0);
+        }
+        std::string const method {RPC::getHandlerNames().front()};
+        perfLog->rpcStart (method, 1);
+        perfLog->rpcFinish (method, 1);
+        Json::Value const histograms {perfLog->histogramsJson()};
+        Json::Value const& jq {histograms[jss::job_queue]};
+        BEAST_EXPECT(jq.size() == 2);
+        Json::Value const& queued {jq[jobType.name()][jss::queued]};
+        BEAST_EXPECT(queued[jss::count] == "100");
+        BEAST_EXPECT(queued[jss::max_us] == "100");
+        BEAST_EXPECT(jsonToUint64 (queued[jss::p50_us]) >= 50);
+        BEAST_EXPECT(jsonToUint64 (queued[jss::p50_us]) <= 53);
+        Json::Value const& running {jq[jobType.name()][jss::running]};
+        BEAST_EXPECT(running[jss::count] == "100");
+        BEAST_EXPECT(running[jss::max_us] == "1000");
+        BEAST_EXPECT(jsonToUint64 (running[jss::p99_us]) >= 990);
+        BEAST_EXPECT(jq[jss::total][jss::running][jss::count] == "100");
+        Json::Value const& rpc {histograms[jss::rpc]};
+        BEAST_EXPECT(rpc.size() == 2);
+        BEAST_EXPECT(rpc[method][jss::count] == "1");
+        BEAST_EXPECT(rpc[jss::total][jss::count] == "1");
+        parent.doStop();
+    }
     void run() override
     {
         testFileCreation();
@@ -776,6 +842,7 @@ public:
         testInvalidID (WithFile::yes);
         testRotate (WithFile::no);
         testRotate (WithFile::yes);
+        testHistograms ();
     }
 };
 BEAST_DEFINE_TESTSUITE(PerfLog, basics, ripple);
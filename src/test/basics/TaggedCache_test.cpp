@@ -1,16 +1,21 @@
 
 #include <ripple/basics/chrono.h>
+#include <ripple/basics/PartitionedTaggedCache.h>
 #include <ripple/basics/TaggedCache.h>
 #include <ripple/beast/unit_test.h>
 #include <ripple/beast/clock/manual_clock.h>
 #include <test/unit_test/SuiteJournal.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 namespace ripple {
 
 class TaggedCache_test : public beast::unit_test::suite
 {
 public:
-    void run () override
+    void testTaggedCache ()
     {
+        testcase ("TaggedCache");
         using namespace std::chrono_literals;
         using namespace beast::severities;
         test::SuiteJournal journal ("TaggedCache_test", *this);
@@ -91,6 +96,171 @@ public:
             BEAST_EXPECT(c.getTrackSize() == 0);
         }
     }
+    void testPartitioned ()
+    {
+        testcase ("PartitionedTaggedCache");
+        using namespace std::chrono_literals;
+        test::SuiteJournal journal ("TaggedCache_test", *this);
+        TestStopwatch clock;
+        clock.set (0);
+        using Key = int;
+        using Value = std::string;
+        using Cache = PartitionedTaggedCache <Key, Value>;
+        Cache c ("test", 64, 1s, clock, journal,
+            beast::insight::NullCollector::New (), 4);
+        BEAST_EXPECT(c.partitions () == 4);
+        BEAST_EXPECT(c.getTargetSize () == 64);
+        for (int i = 0; i < 32; ++i)
+            BEAST_EXPECT(! c.insert (i, std::to_string (i)));
+        BEAST_EXPECT(c.getCacheSize () == 32);
+        BEAST_EXPECT(c.getTrackSize () == 32);
+        BEAST_EXPECT(c.getKeys ().size () == 32);
+        BEAST_EXPECT(c.insert (7, "seven"));
+        {
+            std::string s;
+            BEAST_EXPECT(c.retrieve (7, s));
+            BEAST_EXPECT(s == "7");
+            BEAST_EXPECT(! c.retrieve (100, s));
+        }
+        {
+            Cache::mapped_ptr const p1 (c.fetch (3));
+            BEAST_EXPECT(p1 != nullptr);
+            Cache::mapped_ptr p2 (std::make_shared <Value> ("3"));
+            BEAST_EXPECT(c.canonicalize (3, p2));
+            BEAST_EXPECT(p1.get () == p2.get ());
+            ++clock;
+            c.sweep ();
+            BEAST_EXPECT(c.getCacheSize () == 0);
+            BEAST_EXPECT(c.getTrackSize () == 1);
+            BEAST_EXPECT(c.refreshIfPresent (3));
+            BEAST_EXPECT(c.getCacheSize () == 1);
+        }
+        ++clock;
+        c.sweep ();
+        BEAST_EXPECT(c.getCacheSize () == 0);
+        BEAST_EXPECT(c.getTrackSize () == 0);
+        BEAST_EXPECT(! c.insert (5, "five"));
+        BEAST_EXPECT(c.del (5, true));
+        BEAST_EXPECT(c.getCacheSize () == 0);
+        c.setTargetSize (8);
+        BEAST_EXPECT(c.getTargetSize () == 8);
+        c.setTargetAge (2s);
+        BEAST_EXPECT(c.getTargetAge () == 2s);
+        BEAST_EXPECT(! c.insert (6, "six"));
+        c.reset ();
+        BEAST_EXPECT(c.getCacheSize () == 0);
+        BEAST_EXPECT(c.getTrackSize () == 0);
+    }
+    void testPartitionedSweep ()
+    {
+        testcase ("PartitionedTaggedCache sweep");
+        using namespace std::chrono_literals;
+        test::SuiteJournal journal ("TaggedCache_test", *this);
+        TestStopwatch clock;
+        clock.set (0);
+        using Cache = PartitionedTaggedCache <int, std::string>;
+        Cache c ("test", 0, 8s, clock, journal,
+            beast::insight::NullCollector::New (), 4);
+        c.sweep ();
+        clock.set (1);
+        for (int i = 0; i < 32; ++i)
+            BEAST_EXPECT(! c.insert (i, std::to_string (i)));
+        BEAST_EXPECT(c.fetch (1) != nullptr);
+        BEAST_EXPECT(c.fetch (1) != nullptr);
+        BEAST_EXPECT(c.fetch (1) != nullptr);
+        BEAST_EXPECT(c.fetch (100) == nullptr);
+        BEAST_EXPECT(c.getHitRate () == 75.0f);
+        for (int t = 2; t <= 8; t += 2)
+        {
+            clock.set (t);
+            c.sweep ();
+        }
+        BEAST_EXPECT(c.getCacheSize () == 32);
+        clock.set (10);
+        c.sweep ();
+        BEAST_EXPECT(c.getCacheSize () > 0);
+        for (int t = 12; t <= 16; t += 2)
+        {
+            clock.set (t);
+            c.sweep ();
+        }
+        BEAST_EXPECT(c.getCacheSize () == 0);
+        BEAST_EXPECT(c.getTrackSize () == 0);
+    }
+    void run () override
+    {
+        testTaggedCache ();
+        testPartitioned ();
+        testPartitionedSweep ();
+    }
+};
+class TaggedCache_manual_test : public beast::unit_test::suite
+{
+public:
+    template <class Cache>
+    std::chrono::milliseconds
+    contend (Cache& c, std::size_t threads, int keys, int iterations)
+    {
+        std::atomic<int> mismatches {0};
+        std::vector<std::thread> workers;
+        auto const start = std::chrono::steady_clock::now ();
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back ([&c, &mismatches, t, keys, iterations]
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    int const key = static_cast<int> (
+                        (i * 2654435761u + t) % keys);
+                    auto p = c.fetch (key);
+                    if (! p)
+                    {
+                        p = std::make_shared <std::string> (
+                            std::to_string (key));
+                        c.canonicalize (key, p);
+                    }
+                    if (*p != std::to_string (key))
+                        ++mismatches;
+                }
+            });
+        }
+        for (auto& w : workers)
+            w.join ();
+        BEAST_EXPECT(mismatches == 0);
+        return std::chrono::duration_cast<std::chrono::milliseconds> (
+            std::chrono::steady_clock::now () - start);
+    }
+    void testContention ()
+    {
+        testcase ("contention");
+        using namespace std::chrono_literals;
+        test::SuiteJournal journal ("TaggedCache_test", *this);
+        TestStopwatch clock;
+        clock.set (0);
+        int const keys = 4096;
+        int const iterations = 100000;
+        std::size_t const threads = std::max (2u,
+            std::thread::hardware_concurrency ());
+        TaggedCache <int, std::string> single (
+            "single", keys, 60s, clock, journal);
+        PartitionedTaggedCache <int, std::string> partitioned (
+            "partitioned", keys, 60s, clock, journal);
+        auto const singleTime = contend (single, threads, keys, iterations);
+        auto const partitionedTime = contend (
+            partitioned, threads, keys, iterations);
+        BEAST_EXPECT(single.getCacheSize () == keys);
+        BEAST_EXPECT(partitioned.getCacheSize () == keys);
+        log <<
+            threads << " threads, " << iterations << " lookups each: " <<
+            "TaggedCache " << singleTime.count () << "ms, " <<
+            "PartitionedTaggedCache(" << partitioned.partitions () << ") " <<
+            partitionedTime.count () << "ms" << std::endl;
+    }
+    void run () override
+    {
+        testContention ();
+    }
 };
 BEAST_DEFINE_TESTSUITE(TaggedCache,common,ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(TaggedCache_manual,common,ripple);
 }
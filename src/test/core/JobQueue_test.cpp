@@ -2,6 +2,10 @@
 #include <ripple/core/JobQueue.h>
 #include <ripple/beast/unit_test.h>
 #include <test/jtx/Env.h>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 namespace ripple {
 namespace test {
 class JobQueue_test : public beast::unit_test::suite
@@ -84,13 +88,83 @@ class JobQueue_test : public beast::unit_test::suite
             BEAST_EXPECT (coro == nullptr);
         }
     }
+    void testJobLimits()
+    {
+        jtx::Env env {*this};
+        JobQueue& jQueue = env.app().getJobQueue();
+        jQueue.setThreadCount (8, false);
+        int const limit =
+            JobTypes::instance().get (jtLEDGER_REQ).limit();
+        std::atomic<int> running {0};
+        std::atomic<int> peak {0};
+        std::atomic<int> done {0};
+        int const count = 64;
+        for (int i = 0; i < count; ++i)
+        {
+            jQueue.addJob (jtLEDGER_REQ, "JobLimitTest",
+                [&] (Job&)
+                {
+                    int const now = ++running;
+                    int old = peak;
+                    while (now > old && ! peak.compare_exchange_weak (old, now));
+                    std::this_thread::sleep_for (std::chrono::microseconds (200));
+                    --running;
+                    ++done;
+                });
+        }
+        jQueue.rendezvous();
+        BEAST_EXPECT (done == count);
+        BEAST_EXPECT (peak <= limit);
+        BEAST_EXPECT (jQueue.getJobCountTotal (jtLEDGER_REQ) == 0);
+    }
 public:
     void run() override
     {
         testAddJob();
         testPostCoro();
+        testJobLimits();
+    }
+};
+class JobQueue_manual_test : public beast::unit_test::suite
+{
+public:
+    void run() override
+    {
+        using namespace std::chrono;
+        jtx::Env env {*this};
+        JobQueue& jQueue = env.app().getJobQueue();
+        std::array<JobType, 3> const types {{
+            jtCLIENT, jtTRANSACTION, jtPROPOSAL_t}};
+        int const producers = 4;
+        int const jobs = 200000;
+        for (int threads = 1; threads <= 64; threads *= 2)
+        {
+            testcase ("threads: " + std::to_string (threads));
+            jQueue.setThreadCount (threads, false);
+            std::atomic<int> done {0};
+            auto const start = steady_clock::now();
+            std::vector<std::thread> posters;
+            for (int p = 0; p < producers; ++p)
+            {
+                posters.emplace_back ([&, p]
+                {
+                    for (int i = p; i < jobs; i += producers)
+                        jQueue.addJob (types[i % types.size()], "JobBench",
+                            [&done] (Job&) { ++done; });
+                });
+            }
+            for (auto& t : posters)
+                t.join();
+            jQueue.rendezvous();
+            auto const elapsed =
+                duration_cast<duration<double>> (steady_clock::now() - start);
+            BEAST_EXPECT (done == jobs);
+            log << "    " << static_cast<std::uint64_t> (
+                jobs / elapsed.count()) << " jobs/sec" << std::endl;
+        }
     }
 };
 BEAST_DEFINE_TESTSUITE(JobQueue, core, ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(JobQueue_manual, core, ripple);
 } 
 } 
@@ -40,6 +40,10 @@ class PerfLogTest
     {
         return Json::Value();
     }
+    Json::Value histogramsJson() const override
+    {
+        return Json::Value();
+    }
     void resizeJobs(int const resize) override
     {}
     void rotate() override
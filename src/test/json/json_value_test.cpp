@@ -258,6 +258,97 @@ struct json_value_test : beast::unit_test::suite
       a = std::move(a[0u]);
       pass();
     }
+    void test_references ()
+    {
+        Json::Value object;
+        Json::Value& first = object["m"];
+        first = 1;
+        for (int i = 0; i < 100; ++i)
+            object["k" + std::to_string (i)] = i;
+        object["a"] = "before";
+        BEAST_EXPECT(&first == &object["m"]);
+        BEAST_EXPECT(first == 1);
+        object.removeMember ("k50");
+        BEAST_EXPECT(! object.isMember ("k50"));
+        BEAST_EXPECT(object.size () == 101);
+        BEAST_EXPECT(&first == &object["m"]);
+        std::string previous;
+        for (auto it = object.begin (); it != object.end (); ++it)
+        {
+            std::string const name = it.memberName ();
+            BEAST_EXPECT(previous < name);
+            previous = name;
+        }
+        Json::Value array;
+        Json::Value& head = array.append ("head");
+        for (int i = 0; i < 100; ++i)
+            array.append (i);
+        BEAST_EXPECT(&head == &array[0u]);
+        array.resize (10);
+        BEAST_EXPECT(array.size () == 10);
+        BEAST_EXPECT(array[9u] == 8);
+        Json::Value copy (object);
+        BEAST_EXPECT(copy == object);
+        copy["m"] = 2;
+        BEAST_EXPECT(object < copy);
+    }
+    void test_parse_members ()
+    {
+        std::string json = "{";
+        for (int i = 2000; i > 0; --i)
+        {
+            json += "\"k" + std::to_string (i) + "\":{\"v\":" +
+                std::to_string (i) + ",\"a\":[" + std::to_string (i) + "]}";
+            if (i != 1)
+                json += ",";
+        }
+        json += "}";
+        Json::Value object;
+        Json::Reader r;
+        BEAST_EXPECT(r.parse (json, object));
+        BEAST_EXPECT(object.size () == 2000);
+        BEAST_EXPECT(object["k1"]["v"] == 1);
+        BEAST_EXPECT(object["k1234"]["a"][0u] == 1234);
+        BEAST_EXPECT(! object.isMember ("k0"));
+        std::string previous;
+        for (auto it = object.begin (); it != object.end (); ++it)
+        {
+            std::string const name = it.memberName ();
+            BEAST_EXPECT(previous < name);
+            previous = name;
+        }
+        Json::Value dup;
+        BEAST_EXPECT(! r.parse ("{\"b\":1,\"a\":2,\"b\":3}", dup));
+        BEAST_EXPECT(r.getFormatedErrorMessages ().find (
+            "Key 'b' appears twice.") != std::string::npos);
+        BEAST_EXPECT(! r.parse ("{\"x\":{\"c\":1,\"c\":1}}", dup));
+        BEAST_EXPECT(r.parse ("{\"c\":{\"c\":1},\"d\":{}}", dup));
+        BEAST_EXPECT(dup["c"]["c"] == 1 && dup["d"].isObject ());
+    }
+    void test_inline_strings ()
+    {
+        std::string const shortString ("tesSUCCESS");
+        std::string const longString (64, 'F');
+        Json::Value a (shortString);
+        Json::Value b (longString);
+        BEAST_EXPECT(a.asString () == shortString);
+        BEAST_EXPECT(b.asString () == longString);
+        Json::Value c (a);
+        a = b;
+        BEAST_EXPECT(c.asString () == shortString);
+        BEAST_EXPECT(a.asString () == longString);
+        c.swap (a);
+        BEAST_EXPECT(a.asString () == shortString);
+        BEAST_EXPECT(c.asString () == longString);
+        Json::Value d (std::move (a));
+        BEAST_EXPECT(d.asString () == shortString);
+        BEAST_EXPECT(d == Json::Value ("tesSUCCESS"));
+        BEAST_EXPECT(c < d);
+        Json::Value const empty ("");
+        BEAST_EXPECT(! empty);
+        BEAST_EXPECT(empty.isConvertibleTo (Json::nullValue));
+        BEAST_EXPECT(Json::Value ("123").asInt () == 123);
+    }
     void run () override
     {
         test_bool ();
@@ -270,6 +361,9 @@ struct json_value_test : beast::unit_test::suite
         test_conversions();
         test_nest_limits ();
         test_leak();
+        test_references ();
+        test_parse_members ();
+        test_inline_strings ();
     }
 };
 BEAST_DEFINE_TESTSUITE(json_value, json, ripple);
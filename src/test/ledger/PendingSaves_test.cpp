@@ -1,6 +1,12 @@
 
+#include <ripple/app/ledger/Ledger.h>
+#include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/ledger/PendingSaves.h>
+#include <ripple/app/main/Application.h>
+#include <ripple/core/DatabaseCon.h>
+#include <ripple/core/SociDB.h>
 #include <ripple/beast/unit_test.h>
+#include <test/jtx.h>
 namespace ripple {
 namespace test {
 struct PendingSaves_test : public beast::unit_test::suite
@@ -25,9 +31,182 @@ struct PendingSaves_test : public beast::unit_test::suite
         ps.finishWork(0);
         BEAST_EXPECT(! ps.pending (0));
     }
+    void testQueue()
+    {
+        PendingSaves ps;
+        std::shared_ptr<Ledger const> const ledger;
+        BEAST_EXPECT(ps.queued() == 0);
+        BEAST_EXPECT(ps.takeBatch (4).empty());
+        BEAST_EXPECT(ps.stopWriting (false));
+        BEAST_EXPECT(ps.enqueue (ledger, true));
+        BEAST_EXPECT(! ps.enqueue (ledger, false));
+        BEAST_EXPECT(! ps.enqueue (ledger, true));
+        BEAST_EXPECT(ps.queued() == 3);
+        auto batch = ps.takeBatch (2);
+        BEAST_EXPECT(batch.size() == 2);
+        BEAST_EXPECT(batch[0].second && batch[1].second);
+        BEAST_EXPECT(ps.queued() == 1);
+        BEAST_EXPECT(! ps.stopWriting (true));
+        batch = ps.takeBatch (2);
+        BEAST_EXPECT(batch.size() == 1 && ! batch[0].second);
+        BEAST_EXPECT(! ps.enqueue (ledger, true));
+        BEAST_EXPECT(! ps.stopWriting (true));
+        BEAST_EXPECT(ps.takeBatch (2).size() == 1);
+        BEAST_EXPECT(ps.stopWriting (true));
+        BEAST_EXPECT(ps.enqueue (ledger, true));
+        BEAST_EXPECT(ps.takeBatch (2).size() == 1);
+        BEAST_EXPECT(ps.stopWriting (true));
+    }
+    void testPriority()
+    {
+        PendingSaves ps;
+        std::shared_ptr<Ledger const> const ledger;
+        BEAST_EXPECT(ps.enqueue (ledger, false));
+        BEAST_EXPECT(! ps.enqueue (ledger, false));
+        BEAST_EXPECT(ps.enqueue (ledger, true));
+        BEAST_EXPECT(! ps.enqueue (ledger, true));
+        BEAST_EXPECT(! ps.enqueue (ledger, false));
+        auto batch = ps.takeBatch (3);
+        BEAST_EXPECT(batch.size() == 3);
+        BEAST_EXPECT(batch[0].second && batch[1].second && ! batch[2].second);
+        batch = ps.takeBatch (3);
+        BEAST_EXPECT(batch.size() == 2);
+        BEAST_EXPECT(! batch[0].second && ! batch[1].second);
+        BEAST_EXPECT(ps.stopWriting (true));
+        BEAST_EXPECT(! ps.enqueue (ledger, false));
+        BEAST_EXPECT(ps.enqueue (ledger, true));
+        BEAST_EXPECT(ps.takeBatch (4).size() == 2);
+        BEAST_EXPECT(ps.stopWriting (false));
+        BEAST_EXPECT(ps.stopWriting (true));
+        BEAST_EXPECT(ps.enqueue (ledger, false));
+        ps.abortWriting (false);
+        BEAST_EXPECT(ps.enqueue (ledger, false));
+        BEAST_EXPECT(ps.queued() == 2);
+    }
+    void testBatchWrite()
+    {
+        using namespace jtx;
+        Env env {*this};
+        Account const alice {"alice"};
+        Account const bob {"bob"};
+        env.fund (XRP(10000), alice, bob);
+        env.close ();
+        std::vector<PendingSaves::Save> saves;
+        for (int i = 0; i < 3; ++i)
+        {
+            env (pay (alice, bob, XRP(10 + i)));
+            env (pay (bob, alice, XRP(1)));
+            env.close ();
+            saves.emplace_back (
+                env.app().getLedgerMaster().getClosedLedger(), false);
+        }
+        std::uint32_t const first = saves.front().first->info().seq;
+        {
+            auto db = env.app().getTxnDB().checkoutDb();
+            *db << "DELETE FROM Transactions WHERE LedgerSeq >= :seq;",
+                soci::use (first);
+            *db << "DELETE FROM AccountTransactions WHERE LedgerSeq >= :seq;",
+                soci::use (first);
+        }
+        {
+            auto db = env.app().getLedgerDB().checkoutDb();
+            *db << "DELETE FROM Ledgers WHERE LedgerSeq >= :seq;",
+                soci::use (first);
+        }
+        for (auto const& save : saves)
+        {
+            BEAST_EXPECT(env.app().pendingSaves().shouldWork (
+                save.first->info().seq, true));
+        }
+        BEAST_EXPECT(saveValidatedLedgers (env.app(), saves));
+        for (auto const& save : saves)
+        {
+            auto const& ledger = *save.first;
+            std::uint32_t const seq = ledger.info().seq;
+            BEAST_EXPECT(! env.app().pendingSaves().pending (seq));
+            {
+                auto db = env.app().getLedgerDB().checkoutDb();
+                std::string hash;
+                *db << "SELECT LedgerHash FROM Ledgers WHERE LedgerSeq = :seq;",
+                    soci::use (seq), soci::into (hash);
+                BEAST_EXPECT(hash == to_string (ledger.info().hash));
+            }
+            int txCount = 0;
+            for (auto const& item : ledger.txs)
+            {
+                ++txCount;
+                auto db = env.app().getTxnDB().checkoutDb();
+                std::string const id {
+                    to_string (item.first->getTransactionID())};
+                std::uint32_t txnSeq = 0;
+                soci::blob rawBlob (*db);
+                soci::blob metaBlob (*db);
+                soci::indicator rawInd;
+                soci::indicator metaInd;
+                *db << "SELECT LedgerSeq, RawTxn, TxnMeta FROM Transactions "
+                    "WHERE TransID = :id;",
+                    soci::use (id), soci::into (txnSeq),
+                    soci::into (rawBlob, rawInd),
+                    soci::into (metaBlob, metaInd);
+                BEAST_EXPECT(txnSeq == seq);
+                if (! BEAST_EXPECT(rawInd == soci::i_ok && metaInd == soci::i_ok))
+                    continue;
+                Blob raw;
+                Blob meta;
+                convert (rawBlob, raw);
+                convert (metaBlob, meta);
+                Serializer s;
+                item.first->add (s);
+                BEAST_EXPECT(raw == s.peekData ());
+                SerialIter sit (makeSlice (meta));
+                BEAST_EXPECT(STObject (sit, sfMetadata) == *item.second);
+                int accounts = 0;
+                *db << "SELECT COUNT(*) FROM AccountTransactions "
+                    "WHERE TransID = :id AND LedgerSeq = :seq;",
+                    soci::use (id), soci::use (seq), soci::into (accounts);
+                BEAST_EXPECT(accounts == 2);
+            }
+            BEAST_EXPECT(txCount == 2);
+        }
+    }
+    void testBatchWriteFailure()
+    {
+        using namespace jtx;
+        Env env {*this};
+        Account const alice {"alice"};
+        env.fund (XRP(10000), alice);
+        env.close ();
+        std::vector<PendingSaves::Save> saves;
+        for (int i = 0; i < 2; ++i)
+        {
+            env (pay (env.master, alice, XRP(10)));
+            env.close ();
+            saves.emplace_back (
+                env.app().getLedgerMaster().getClosedLedger(), false);
+        }
+        {
+            auto db = env.app().getTxnDB().checkoutDb();
+            *db << "DROP TABLE AccountTransactions;";
+        }
+        for (auto const& save : saves)
+        {
+            BEAST_EXPECT(env.app().pendingSaves().shouldWork (
+                save.first->info().seq, true));
+        }
+        BEAST_EXPECT(! saveValidatedLedgers (env.app(), saves));
+        for (auto const& save : saves)
+        {
+            BEAST_EXPECT(! env.app().pendingSaves().pending (
+                save.first->info().seq));
+        }
+    }
     void run() override
     {
         testSaves();
+        testQueue();
+        testPriority();
+        testBatchWrite();
+        testBatchWriteFailure();
     }
 };
 BEAST_DEFINE_TESTSUITE(PendingSaves,ledger,ripple);
@@ -0,0 +1,200 @@
+
+#include <ripple/app/ledger/LedgerMaster.h>
+#include <ripple/app/main/Application.h>
+#include <ripple/beast/utility/temp_dir.h>
+#include <ripple/core/ConfigSections.h>
+#include <ripple/core/JobQueue.h>
+#include <ripple/nodestore/DatabaseShard.h>
+#include <ripple/protocol/HashPrefix.h>
+#include <ripple/protocol/Indexes.h>
+#include <test/jtx.h>
+#include <mutex>
+#include <string>
+#include <vector>
+namespace ripple {
+namespace NodeStore {
+class DatabaseShard_test : public beast::unit_test::suite
+{
+    static std::uint32_t constexpr ledgersPerShard = 512;
+    static std::uint32_t constexpr earliestSeq = 3;
+    static std::uint32_t constexpr lastSeq = ledgersPerShard;
+    class ShardLogs : public Logs
+    {
+        class CaptureSink : public beast::Journal::Sink
+        {
+            ShardLogs& logs_;
+        public:
+            CaptureSink(beast::severities::Severity threshold,
+                ShardLogs& logs)
+                : beast::Journal::Sink(threshold, false)
+                , logs_(logs)
+            {
+            }
+            void
+            write(beast::severities::Severity level,
+                std::string const& text) override
+            {
+                std::lock_guard<std::mutex> lock(logs_.mutex_);
+                logs_.messages_ += text + '\n';
+            }
+        };
+        beast::unit_test::suite& suite_;
+        std::mutex mutex_;
+        std::string messages_;
+    public:
+        explicit ShardLogs(beast::unit_test::suite& suite)
+            : Logs(beast::severities::kError)
+            , suite_(suite)
+        {
+        }
+        std::unique_ptr<beast::Journal::Sink>
+        makeSink(std::string const& partition,
+            beast::severities::Severity threshold) override
+        {
+            if (partition == "ShardStore")
+                return std::make_unique<CaptureSink>(threshold, *this);
+            return std::make_unique<test::SuiteJournalSink>(
+                partition, threshold, suite_);
+        }
+        bool
+        contains(std::string const& text)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return messages_.find(text) != std::string::npos;
+        }
+    };
+    static
+    std::unique_ptr<Config>
+    shardConfig(std::unique_ptr<Config> cfg, std::string const& path)
+    {
+        auto& section = cfg->section(ConfigSection::shardDatabase());
+        section.set("type", "memory");
+        section.set("path", path);
+        section.set("max_size_gb", "10");
+        section.set("ledgers_per_shard", std::to_string(ledgersPerShard));
+        section.set("earliest_seq", std::to_string(earliestSeq));
+        section.set("validate_threads", "4");
+        return cfg;
+    }
+    static
+    void
+    storeLedger(DatabaseShard& db, Ledger const& ledger, uint256 const& skip)
+    {
+        auto const seq {ledger.info().seq};
+        {
+            Serializer s(1024);
+            s.add32(HashPrefix::ledgerMaster);
+            addRaw(ledger.info(), s);
+            db.store(hotLEDGER, std::move(s.modData()),
+                ledger.info().hash, seq);
+        }
+        auto store = [&](NodeObjectType type)
+        {
+            return [&db, &skip, seq, type](SHAMapAbstractNode& node)
+            {
+                auto const hash {node.getNodeHash().as_uint256()};
+                if (hash != skip)
+                {
+                    Serializer s;
+                    node.addRaw(s, snfPREFIX);
+                    db.store(type, std::move(s.modData()), hash, seq);
+                }
+                return true;
+            };
+        };
+        ledger.stateMap().visitNodes(store(hotACCOUNT_NODE));
+        ledger.txMap().visitNodes(store(hotTRANSACTION_NODE));
+    }
+    void
+    testValidate(std::uint32_t brokenSeq)
+    {
+        using namespace test::jtx;
+        beast::temp_dir shardDir;
+        auto logs {std::make_unique<ShardLogs>(*this)};
+        auto& messages {*logs};
+        Env env {*this, envconfig(shardConfig, shardDir.path()),
+            std::move(logs)};
+        env.app().logs()["ShardStore"].threshold(beast::severities::kDebug);
+        auto const alice {Account {"alice"}};
+        auto const bob {Account {"bob"}};
+        env.fund(XRP(100000), alice, bob);
+        env.close();
+        while (env.closed()->info().seq <= lastSeq + 2)
+        {
+            env(pay(alice, bob, XRP(1)));
+            env.close();
+        }
+        env.app().getJobQueue().rendezvous();
+        auto& ledgerMaster {env.app().getLedgerMaster()};
+        auto db {env.app().getShardStore()};
+        if (!BEAST_EXPECT(db))
+            return;
+        for (auto seq = db->prepareLedger(ledgerMaster.getValidLedgerIndex());
+            seq; seq = db->prepareLedger(ledgerMaster.getValidLedgerIndex()))
+        {
+            auto const ledger {ledgerMaster.getLedgerBySeq(*seq)};
+            if (!BEAST_EXPECT(ledger))
+                return;
+            if (*seq == brokenSeq)
+            {
+                SHAMapHash leaf;
+                BEAST_EXPECT(ledger->stateMap().peekItem(
+                    keylet::account(alice).key, leaf) != nullptr);
+                storeLedger(*db, *ledger, leaf.as_uint256());
+                db->setStored(ledger);
+            }
+            else if (!BEAST_EXPECT(db->copyLedger(ledger)))
+                return;
+        }
+        BEAST_EXPECT(db->getCompleteShards() == "0");
+        BEAST_EXPECT(db->contains(earliestSeq) && db->contains(lastSeq));
+        if (brokenSeq == 0)
+        {
+            auto const ledger {ledgerMaster.getLedgerBySeq(lastSeq)};
+            if (!BEAST_EXPECT(ledger))
+                return;
+            std::vector<uint256> hashes;
+            ledger->stateMap().visitNodes(
+                [&hashes](SHAMapAbstractNode& node)
+                {
+                    hashes.push_back(node.getNodeHash().as_uint256());
+                    return true;
+                });
+            hashes.push_back(uint256{1});
+            auto const nObjs {db->fetchBatch(hashes, lastSeq)};
+            if (BEAST_EXPECT(nObjs.size() == hashes.size()))
+            {
+                for (std::size_t i = 0; i + 1 < hashes.size(); ++i)
+                {
+                    BEAST_EXPECT(nObjs[i] &&
+                        nObjs[i]->getHash() == hashes[i]);
+                }
+                BEAST_EXPECT(!nObjs.back());
+            }
+        }
+        db->validate();
+        if (brokenSeq == 0)
+        {
+            BEAST_EXPECT(messages.contains("shard 0 is complete."));
+            BEAST_EXPECT(!messages.contains("is invalid"));
+        }
+        else
+        {
+            BEAST_EXPECT(messages.contains("shard 0 is invalid, failed at seq " +
+                std::to_string(brokenSeq) + " "));
+            BEAST_EXPECT(!messages.contains("shard 0 is complete."));
+        }
+    }
+public:
+    void
+    run() override
+    {
+        testcase("validate complete shard");
+        testValidate(0);
+        testcase("validate shard with a missing node");
+        testValidate(200);
+    }
+};
+BEAST_DEFINE_TESTSUITE(DatabaseShard,NodeStore,ripple);
+}
+}
@@ -3,6 +3,7 @@
 #include <ripple/nodestore/DummyScheduler.h>
 #include <ripple/nodestore/Manager.h>
 #include <ripple/beast/utility/temp_dir.h>
+#include <ripple/protocol/jss.h>
 #include <test/unit_test/SuiteJournal.h>
 namespace ripple {
 namespace NodeStore {
@@ -48,6 +49,81 @@ public:
         std::sort (copy.begin (), copy.end (), LessThan{});
         BEAST_EXPECT(areBatchesEqual (batch, copy));
     }
+    void testFetchBatch (std::string const& type, std::int64_t seedValue)
+    {
+        DummyScheduler scheduler;
+        RootStoppable parent ("TestRootStoppable");
+        testcase ("fetchBatch '" + type + "'");
+        beast::temp_dir node_db;
+        Section nodeParams;
+        nodeParams.set ("type", type);
+        nodeParams.set ("path", node_db.path());
+        auto batch = createPredictableBatch (
+            numObjectsToTest, seedValue);
+        auto missing = createPredictableBatch (
+            numObjectsToTest / 4, seedValue + 1);
+        std::unique_ptr <Database> db = Manager::instance().make_Database (
+            "test", scheduler, 2, parent, nodeParams, journal_);
+        storeBatch (*db, batch);
+        std::vector<uint256> hashes;
+        for (auto const& nObj : batch)
+            hashes.push_back (nObj->getHash ());
+        for (auto const& nObj : missing)
+            hashes.push_back (nObj->getHash ());
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            auto const nObjs = db->fetchBatch (hashes, 0);
+            if (! BEAST_EXPECT(nObjs.size () == hashes.size ()))
+                return;
+            Batch copy;
+            for (std::size_t i = 0; i < batch.size (); ++i)
+                if (BEAST_EXPECT(nObjs[i]))
+                    copy.push_back (nObjs[i]);
+            BEAST_EXPECT(areBatchesEqual (batch, copy));
+            for (std::size_t i = batch.size (); i < nObjs.size (); ++i)
+                BEAST_EXPECT(! nObjs[i]);
+        }
+    }
+    void testReadQueue (std::int64_t seedValue)
+    {
+        DummyScheduler scheduler;
+        RootStoppable parent ("TestRootStoppable");
+        testcase ("read queue");
+        beast::temp_dir node_db;
+        Section nodeParams;
+        nodeParams.set ("type", "memory");
+        nodeParams.set ("path", node_db.path());
+        nodeParams.set ("read_queue_client", "2");
+        auto batch = createPredictableBatch (8, seedValue);
+        std::unique_ptr <Database> db = Manager::instance().make_Database (
+            "test", scheduler, 0, parent, nodeParams, journal_);
+        std::shared_ptr<NodeObject> object;
+        for (auto const& nObj : batch)
+            BEAST_EXPECT(! db->asyncFetch (nObj->getHash (), 0, object,
+                ReadPriority::history));
+        for (int i = 0; i < 4; ++i)
+            BEAST_EXPECT(! db->asyncFetch (batch[i]->getHash (), 0, object,
+                ReadPriority::critical));
+        BEAST_EXPECT(! db->asyncFetch (batch[0]->getHash (), 0, object,
+            ReadPriority::history));
+        auto const other = createPredictableBatch (3, seedValue + 1);
+        for (auto const& nObj : other)
+            BEAST_EXPECT(! db->asyncFetch (nObj->getHash (), 0, object,
+                ReadPriority::client));
+        BEAST_EXPECT(! db->asyncFetch (batch[5]->getHash (), 0, object,
+            ReadPriority::client));
+        Json::Value counts (Json::objectValue);
+        db->getCountsJson (counts);
+        auto const& rq = counts[jss::read_queue];
+        BEAST_EXPECT(rq["critical"][jss::depth].asUInt () == 4);
+        BEAST_EXPECT(rq["critical"][jss::coalesced].asUInt () == 4);
+        BEAST_EXPECT(rq["history"][jss::depth].asUInt () == 4);
+        BEAST_EXPECT(rq["history"][jss::coalesced].asUInt () == 1);
+        BEAST_EXPECT(rq["client"][jss::depth].asUInt () == 2);
+        BEAST_EXPECT(rq["client"][jss::coalesced].asUInt () == 1);
+        BEAST_EXPECT(rq["client"][jss::limit].asUInt () == 2);
+        BEAST_EXPECT(rq["client"][jss::dropped].asUInt () == 1);
+    }
     void testNodeStore (std::string const& type,
                         bool const testPersistence,
                         std::int64_t const seedValue,
@@ -139,6 +215,12 @@ public:
     {
         std::int64_t const seedValue = 50;
         testNodeStore ("memory", false, seedValue);
+        testFetchBatch ("memory", seedValue);
+        testReadQueue (seedValue);
+        testFetchBatch ("nudb", seedValue);
+    #if RIPPLE_ROCKSDB_AVAILABLE
+        testFetchBatch ("rocksdb", seedValue);
+    #endif
         {
             testNodeStore ("nudb", true, seedValue);
         #if RIPPLE_ROCKSDB_AVAILABLE
@@ -0,0 +1,124 @@
+
+#include <ripple/overlay/impl/SendQueue.h>
+#include <ripple/beast/unit_test.h>
+#include <memory>
+namespace ripple {
+class SendQueue_test : public beast::unit_test::suite
+{
+    static
+    Message::pointer
+    make (int type, std::size_t size = 0)
+    {
+        switch (type)
+        {
+        case protocol::mtTRANSACTION:
+        {
+            protocol::TMTransaction m;
+            m.set_rawtransaction (std::string (size, 'x'));
+            m.set_status (protocol::tsNEW);
+            return std::make_shared<Message> (m, type);
+        }
+        case protocol::mtSTATUS_CHANGE:
+        {
+            protocol::TMStatusChange m;
+            m.set_networktime (size);
+            return std::make_shared<Message> (m, type);
+        }
+        case protocol::mtGET_PEERS:
+        {
+            protocol::TMGetPeers m;
+            m.set_doweneedthis (0);
+            return std::make_shared<Message> (m, type);
+        }
+        default:
+        {
+            protocol::TMProposeSet m;
+            m.set_proposeseq (0);
+            m.set_currenttxhash (std::string (32, 'x'));
+            m.set_nodepubkey (std::string (33, 'x'));
+            m.set_signature (std::string (size, 'x'));
+            m.set_closetime (0);
+            m.set_previousledger (std::string (32, 'x'));
+            return std::make_shared<Message> (m, type);
+        }
+        }
+    }
+    static
+    int
+    frontType (SendQueue& q)
+    {
+        return Message::getType (q.front ()->getBuffer ());
+    }
+public:
+    void
+    testPriority()
+    {
+        testcase ("priority");
+        SendQueue q;
+        BEAST_EXPECT(q.empty ());
+        q.push (make (protocol::mtGET_PEERS));
+        q.push (make (protocol::mtTRANSACTION));
+        q.push (make (protocol::mtPROPOSE_LEDGER));
+        BEAST_EXPECT(q.size () == 3);
+        BEAST_EXPECT(frontType (q) == protocol::mtPROPOSE_LEDGER);
+        BEAST_EXPECT(q.frontLane () == TrafficCount::lane::consensus);
+        q.push (make (protocol::mtPROPOSE_LEDGER));
+        BEAST_EXPECT(frontType (q) == protocol::mtPROPOSE_LEDGER);
+        q.pop ();
+        BEAST_EXPECT(frontType (q) == protocol::mtPROPOSE_LEDGER);
+        q.pop ();
+        BEAST_EXPECT(frontType (q) == protocol::mtTRANSACTION);
+        BEAST_EXPECT(q.frontLane () == TrafficCount::lane::transactions);
+        q.pop ();
+        BEAST_EXPECT(frontType (q) == protocol::mtGET_PEERS);
+        BEAST_EXPECT(q.frontLane () == TrafficCount::lane::discovery);
+        q.pop ();
+        BEAST_EXPECT(q.empty ());
+    }
+    void
+    testFairness()
+    {
+        testcase ("fairness");
+        SendQueue q;
+        for (int i = 0; i < 64; ++i)
+            q.push (make (protocol::mtPROPOSE_LEDGER, 4096));
+        q.push (make (protocol::mtTRANSACTION));
+        int sent = 0;
+        while (frontType (q) != protocol::mtTRANSACTION)
+        {
+            q.pop ();
+            ++sent;
+        }
+        BEAST_EXPECT(sent > 0 && sent < 64);
+        q.pop ();
+        BEAST_EXPECT(q.size () == 64 - sent);
+    }
+    void
+    testCoalesce()
+    {
+        testcase ("coalesce");
+        SendQueue q;
+        q.push (make (protocol::mtSTATUS_CHANGE, 1));
+        auto const inFlight = q.front ();
+        q.push (make (protocol::mtSTATUS_CHANGE, 2));
+        q.push (make (protocol::mtPROPOSE_LEDGER));
+        q.push (make (protocol::mtSTATUS_CHANGE, 3));
+        BEAST_EXPECT(q.size () == 3);
+        BEAST_EXPECT(q.front () == inFlight);
+        q.pop ();
+        BEAST_EXPECT(frontType (q) == protocol::mtPROPOSE_LEDGER);
+        q.pop ();
+        BEAST_EXPECT(frontType (q) == protocol::mtSTATUS_CHANGE);
+        q.pop ();
+        BEAST_EXPECT(q.empty ());
+    }
+    void
+    run() override
+    {
+        testPriority();
+        testFairness();
+        testCoalesce();
+    }
+};
+BEAST_DEFINE_TESTSUITE(SendQueue,overlay,ripple);
+}
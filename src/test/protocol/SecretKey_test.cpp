@@ -174,6 +174,43 @@ public:
             }
         }
     }
+    void testBatchVerify ()
+    {
+        testcase ("batch verify");
+        std::vector<blob> data (150);
+        std::vector<Buffer> sigs;
+        sigs.reserve (data.size());
+        std::vector<SignedMessage> batch;
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            auto const keypair = randomKeyPair (
+                i % 10 == 0 ? KeyType::secp256k1 : KeyType::ed25519);
+            data[i].resize (32 + i);
+            beast::rngfill (
+                data[i].data(),
+                data[i].size(),
+                crypto_prng());
+            sigs.push_back (sign (keypair.first, keypair.second,
+                makeSlice (data[i])));
+            batch.push_back ({keypair.first, makeSlice (data[i]),
+                sigs.back(), true});
+        }
+        auto valid = verifyBatch (batch);
+        BEAST_EXPECT(valid.size() == batch.size());
+        BEAST_EXPECT(std::all_of (valid.begin(), valid.end(),
+            [](bool v) { return v; }));
+        for (auto i : {3, 20, 70, 149})
+            sigs[i].data()[i % 64]++;
+        valid = verifyBatch (batch);
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            BEAST_EXPECT(valid[i] == verify (batch[i].publicKey,
+                batch[i].message, batch[i].signature, true));
+            BEAST_EXPECT(valid[i] ==
+                (i != 3 && i != 20 && i != 70 && i != 149));
+        }
+        BEAST_EXPECT(verifyBatch ({}).empty());
+    }
     void testBase58 ()
     {
         testcase ("Base58");
@@ -284,6 +321,7 @@ public:
         testSigning(KeyType::secp256k1);
         testcase ("ed25519");
         testSigning(KeyType::ed25519);
+        testBatchVerify();
     }
 };
 BEAST_DEFINE_TESTSUITE(SecretKey,protocol,ripple);
@@ -1,5 +1,6 @@
 
 #include <ripple/protocol/digest.h>
+#include <ripple/basics/Blob.h>
 #include <ripple/beast/utility/rngfill.h>
 #include <ripple/beast/xor_shift_engine.h>
 #include <ripple/beast/unit_test.h>
@@ -10,6 +11,81 @@
 #include <numeric>
 #include <vector>
 namespace ripple {
+class sha512HalfBatch_test : public beast::unit_test::suite
+{
+    void check (Slice const* messages, std::size_t count)
+    {
+        std::vector<uint256> digests (count);
+        sha512HalfBatch (messages, digests.data(), count);
+        bool match = true;
+        for (std::size_t i = 0; i < count; ++i)
+            match &= (digests[i] == sha512Half (messages[i]));
+        BEAST_EXPECT(match);
+    }
+    void testEmpty ()
+    {
+        testcase ("Empty");
+        sha512HalfBatch (nullptr, nullptr, 0);
+        std::vector<Slice> const messages (5);
+        for (std::size_t count = 1; count <= messages.size(); ++count)
+            check (messages.data(), count);
+    }
+    void testLengths ()
+    {
+        testcase ("Lengths");
+        beast::xor_shift_engine g(8151);
+        std::vector<Blob> blobs;
+        for (std::size_t size : {1, 55, 110, 111, 112, 113, 127, 128, 129,
+            239, 240, 241, 255, 256, 257, 516, 700})
+        {
+            blobs.emplace_back (size);
+            beast::rngfill (blobs.back().data(), blobs.back().size(), g);
+        }
+        std::vector<Slice> messages;
+        for (auto const& b : blobs)
+            messages.emplace_back (b.data(), b.size());
+        for (auto const& m : messages)
+        {
+            std::vector<Slice> const same (4, m);
+            check (same.data(), same.size());
+        }
+        for (std::size_t first = 0; first < 4; ++first)
+        {
+            for (std::size_t count = 0;
+                first + count <= messages.size(); ++count)
+            {
+                check (messages.data() + first, count);
+            }
+        }
+    }
+    void testMixed ()
+    {
+        testcase ("Mixed");
+        beast::xor_shift_engine g(19207813);
+        std::vector<Blob> blobs;
+        for (std::size_t size = 0; size < 700; size += 13)
+        {
+            blobs.emplace_back (size);
+            beast::rngfill (blobs.back().data(), blobs.back().size(), g);
+        }
+        std::vector<Slice> messages;
+        for (auto const& b : blobs)
+            messages.emplace_back (b.data(), b.size());
+        for (std::size_t count = 1; count <= messages.size(); count += 2)
+            check (messages.data(), count);
+        std::reverse (messages.begin(), messages.end());
+        for (std::size_t count = 1; count <= messages.size(); count += 2)
+            check (messages.data(), count);
+    }
+public:
+    void run () override
+    {
+        testEmpty ();
+        testLengths ();
+        testMixed ();
+    }
+};
+BEAST_DEFINE_TESTSUITE(sha512HalfBatch,protocol,ripple);
 class digest_test : public beast::unit_test::suite
 {
     std::vector<uint256> dataset1;
@@ -111,11 +187,32 @@ public:
         test<beast::ripemd160_hasher> ("Beast");
         pass ();
     }
+    void testSHA512HalfBatch ()
+    {
+        testcase ("SHA512Half batch");
+        using namespace std::chrono;
+        std::vector<Slice> inner (dataset1.size() / 16);
+        for (std::size_t i = 0; i < inner.size(); ++i)
+            inner[i] = Slice (dataset1[i * 16].data(), 16 * 32);
+        std::vector<uint256> digests (inner.size());
+        auto const start = high_resolution_clock::now ();
+        sha512HalfBatch (inner.data(), digests.data(), inner.size());
+        auto const batch = high_resolution_clock::now () - start;
+        for (std::size_t i = 0; i < inner.size(); ++i)
+            digests[i] = sha512Half (inner[i]);
+        auto const scalar = high_resolution_clock::now () - start - batch;
+        log <<
+            "    " << inner.size() << " inner nodes: batch " <<
+            duration_cast<milliseconds>(batch).count() << "ms, scalar " <<
+            duration_cast<milliseconds>(scalar).count() << "ms" << std::endl;
+        pass ();
+    }
     void run () override
     {
         testSHA512 ();
         testSHA256 ();
         testRIPEMD160 ();
+        testSHA512HalfBatch ();
     }
 };
 BEAST_DEFINE_TESTSUITE_MANUAL_PRIO(digest,ripple_data,ripple,20);
@@ -3,6 +3,7 @@
 #include <ripple/protocol/Feature.h>
 #include <ripple/protocol/jss.h>
 #include <test/jtx.h>
+#include <test/jtx/JSONRPCClient.h>
 namespace ripple {
 class LedgerData_test : public beast::unit_test::suite
 {
@@ -77,6 +78,48 @@ public:
         BEAST_EXPECT( ! jrr.isMember(jss::marker) );
         BEAST_EXPECT( checkArraySize(jrr[jss::state], num_accounts + 3) );
     }
+    void testStreamedResponse()
+    {
+        using namespace test::jtx;
+        Env env { *this };
+        Account const gw { "gateway" };
+        env.fund(XRP(100000), gw);
+        for (auto i = 0; i < 10; i++)
+        {
+            Account const bob { std::string("bob") + std::to_string(i) };
+            env.fund(XRP(1000), bob);
+        }
+        env.close();
+        auto client = test::makeJSONRPCClient(env.app().config(), 1);
+        for (auto const binary : {false, true})
+        {
+            Json::Value jvParams;
+            jvParams[jss::ledger_index] = "closed";
+            jvParams[jss::binary] = binary;
+            jvParams[jss::limit] = 5;
+            auto const direct = env.rpc ( "json", "ledger_data",
+                boost::lexical_cast<std::string>(jvParams)) [jss::result];
+            auto const streamed =
+                client->invoke("ledger_data", jvParams) [jss::result];
+            BEAST_EXPECT(streamed[jss::status] == "success");
+            BEAST_EXPECT(checkMarker(streamed));
+            BEAST_EXPECT(streamed[jss::marker] == direct[jss::marker]);
+            BEAST_EXPECT(streamed[jss::ledger] == direct[jss::ledger]);
+            BEAST_EXPECT(streamed[jss::state] == direct[jss::state]);
+            BEAST_EXPECT(checkArraySize(streamed[jss::state], 5));
+        }
+        {
+            Json::Value jvParams;
+            jvParams[jss::ledger_index] = "closed";
+            jvParams[jss::marker] = "NOT_A_MARKER";
+            auto const streamed =
+                client->invoke("ledger_data", jvParams) [jss::result];
+            BEAST_EXPECT(streamed[jss::status] == "error");
+            BEAST_EXPECT(streamed[jss::error] == "invalidParams");
+            BEAST_EXPECT(streamed[jss::request][jss::marker] ==
+                "NOT_A_MARKER");
+        }
+    }
     void testBadInput()
     {
         using namespace test::jtx;
@@ -369,6 +412,7 @@ public:
         testCurrentLedgerToLimits(true);
         testCurrentLedgerToLimits(false);
         testCurrentLedgerBinary();
+        testStreamedResponse();
         testBadInput();
         testMarkerFollow();
         testLedgerHeader();
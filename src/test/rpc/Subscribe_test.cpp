@@ -2,7 +2,10 @@
 #include <ripple/app/main/LoadManager.h>
 #include <ripple/app/misc/LoadFeeTrack.h>
 #include <ripple/app/misc/NetworkOPs.h>
+#include <ripple/basics/StringUtilities.h>
 #include <ripple/core/ConfigSections.h>
+#include <ripple/ledger/TxMeta.h>
+#include <ripple/protocol/STTx.h>
 #include <ripple/protocol/jss.h>
 #include <test/jtx/WSClient.h>
 #include <test/jtx/envconfig.h>
@@ -213,6 +216,54 @@ public:
         }
         BEAST_EXPECT(jv[jss::status] == "success");
     }
+    void testBinaryTransactions()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+        Env env(*this);
+        auto wsc = makeWSClient(env.app().config());
+        {
+            Json::Value stream;
+            stream[jss::streams] = Json::arrayValue;
+            stream[jss::streams].append("transactions");
+            stream[jss::binary] = "yes";
+            auto jv = wsc->invoke("subscribe", stream);
+            BEAST_EXPECT(jv[jss::result][jss::error] == "invalidParams");
+        }
+        Json::Value stream;
+        stream[jss::streams] = Json::arrayValue;
+        stream[jss::streams].append("transactions");
+        stream[jss::binary] = true;
+        auto jv = wsc->invoke("subscribe", stream);
+        BEAST_EXPECT(jv[jss::status] == "success");
+        env.fund(XRP(10000), "alice");
+        env.close();
+        BEAST_EXPECT(wsc->findMsg(5s,
+            [&](auto const& jv)
+            {
+                if (! jv[jss::transaction][jss::tx].isString() ||
+                    ! jv[jss::meta].isString())
+                    return false;
+                auto const tx = strUnHex(
+                    jv[jss::transaction][jss::tx].asString());
+                auto const meta = strUnHex(jv[jss::meta].asString());
+                if (! tx.second || ! meta.second)
+                    return false;
+                SerialIter sitTx(makeSlice(tx.first));
+                STTx const stTx(sitTx);
+                if (to_string(stTx.getTransactionID()) !=
+                        jv[jss::transaction][jss::hash].asString())
+                    return false;
+                TxMeta const txMeta(stTx.getTransactionID(),
+                    jv[jss::ledger_index].asUInt(), meta.first);
+                return jv[jss::validated].asBool() &&
+                    txMeta.getResultTER() == tesSUCCESS &&
+                    stTx.getAccountID(sfDestination) ==
+                        Account("alice").id();
+            }));
+        jv = wsc->invoke("unsubscribe", stream);
+        BEAST_EXPECT(jv[jss::status] == "success");
+    }
     void testManifests()
     {
         using namespace jtx;
@@ -541,6 +592,7 @@ public:
         testServer();
         testLedger();
         testTransactions();
+        testBinaryTransactions();
         testManifests();
         testValidations();
         testSubErrors(true);
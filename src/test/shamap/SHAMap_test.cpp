@@ -264,6 +264,41 @@ public:
                 --h;
             }
         }
+        if (backed)
+            testcase ("parallel flush backed");
+        else
+            testcase ("parallel flush unbacked");
+        {
+            tests::TestFamily serialFamily{journal};
+            tests::TestFamily parallelFamily{journal};
+            parallelFamily.setFlushThreads (4);
+            SHAMap serial{SHAMapType::FREE, serialFamily, v};
+            SHAMap parallel{SHAMapType::FREE, parallelFamily, v};
+            if (! backed)
+            {
+                serial.setUnbacked ();
+                parallel.setUnbacked ();
+            }
+            for (int i = 0; i < 1000; ++i)
+            {
+                uint256 key;
+                key.data()[0] = static_cast<unsigned char> (i * 37);
+                key.data()[1] = static_cast<unsigned char> (i >> 3);
+                key.data()[31] = static_cast<unsigned char> (i);
+                BEAST_EXPECT(serial.addItem (
+                    SHAMapItem{key, IntToVUC(i)}, false, false));
+                BEAST_EXPECT(parallel.addItem (
+                    SHAMapItem{key, IntToVUC(i)}, false, false));
+            }
+            int const serialFlushed = serial.flushDirty (hotTRANSACTION_NODE, 1);
+            int const parallelFlushed = parallel.flushDirty (hotTRANSACTION_NODE, 1);
+            BEAST_EXPECT(serialFlushed == parallelFlushed);
+            BEAST_EXPECT(serial.getHash() == parallel.getHash());
+            parallel.invariants();
+            if (backed)
+                BEAST_EXPECT(parallelFamily.db().fetch (
+                    parallel.getHash().as_uint256(), 0) != nullptr);
+        }
     }
 };
 BEAST_DEFINE_TESTSUITE(SHAMap,ripple_app,ripple);
@@ -5,6 +5,10 @@
 #include <ripple/nodestore/DummyScheduler.h>
 #include <ripple/nodestore/Manager.h>
 #include <ripple/shamap/Family.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/optional.hpp>
+#include <thread>
+#include <vector>
 namespace ripple {
 namespace tests {
 class TestFamily : public Family
@@ -17,6 +21,10 @@ private:
     RootStoppable parent_;
     std::unique_ptr<NodeStore::Database> db_;
     bool shardBacked_;
+    std::size_t flushThreads_ = 0;
+    boost::asio::io_service flushService_;
+    boost::optional<boost::asio::io_service::work> flushWork_;
+    std::vector<std::thread> flushHelpers_;
     beast::Journal j_;
 public:
     TestFamily (beast::Journal j)
@@ -34,6 +42,12 @@ public:
         shardBacked_ =
             dynamic_cast<NodeStore::DatabaseShard*>(db_.get()) != nullptr;
     }
+    ~TestFamily ()
+    {
+        flushWork_ = boost::none;
+        for (auto& helper : flushHelpers_)
+            helper.join ();
+    }
     beast::manual_clock <std::chrono::steady_clock>
     clock()
     {
@@ -79,6 +93,25 @@ public:
     {
         return shardBacked_;
     }
+    std::size_t
+    flushThreads() const override
+    {
+        return flushThreads_;
+    }
+    void
+    setFlushThreads (std::size_t threads)
+    {
+        flushThreads_ = threads;
+        if (! flushWork_)
+            flushWork_.emplace (flushService_);
+        while (flushHelpers_.size () + 1 < threads)
+            flushHelpers_.emplace_back ([this] { flushService_.run (); });
+    }
+    void
+    addFlushJob (std::function<void()> job) override
+    {
+        flushService_.post (std::move (job));
+    }
     void
     missing_node (std::uint32_t refNum) override
     {
@@ -10,6 +10,7 @@
 #include <test/app/SetRegularKey_test.cpp>
 #include <test/app/SetTrust_test.cpp>
 #include <test/app/SHAMapStore_test.cpp>
+#include <test/app/SignatureVerifier_test.cpp>
 #include <test/app/Taker_test.cpp>
 #include <test/app/Ticket_test.cpp>
 #include <test/app/Transaction_ordering_test.cpp>
@@ -1,4 +1,5 @@
 
+#include <test/basics/Archive_test.cpp>
 #include <test/basics/base64_test.cpp>
 #include <test/basics/base_uint_test.cpp>
 #include <test/basics/Buffer_test.cpp>
@@ -1,4 +1,5 @@
 
 #include <test/overlay/cluster_test.cpp>
 #include <test/overlay/short_read_test.cpp>
+#include <test/overlay/SendQueue_test.cpp>
 #include <test/overlay/TMHello_test.cpp>